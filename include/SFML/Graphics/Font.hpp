@@ -37,6 +37,7 @@
 
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -49,6 +50,7 @@
 namespace sf
 {
 class InputStream;
+class Shader;
 
 ////////////////////////////////////////////////////////////
 /// \brief Class for loading and manipulating character fonts
@@ -66,6 +68,59 @@ public:
         std::string family; //!< The font family
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Algorithms used to pack glyphs into page textures
+    ///
+    /// \see `setPackingAlgorithm`
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class PackingAlgorithm
+    {
+        Rows,   //!< Glyphs are placed on horizontal rows of similar heights
+        Skyline //!< Glyphs are placed at the lowest position along the skyline of the packed glyphs
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Representations of the glyphs stored in page textures
+    ///
+    /// \see `setGlyphMode`
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class GlyphMode
+    {
+        Bitmap,             //!< Glyphs are rasterized separately for every character size
+        SignedDistanceField //!< Glyphs are stored once as distance fields, which serve every character size
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics about the usage of a page texture
+    ///
+    /// \see `getPageStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PageStatistics
+    {
+        Vector2u      textureSize;      //!< Size of the page texture, in pixels
+        std::size_t   glyphCount{};     //!< Number of glyphs packed into the texture
+        std::uint64_t usedArea{};       //!< Area covered by the packed glyphs and their padding, in pixels
+        float         occupancy{};      //!< Fraction of the texture area covered by the packed glyphs
+        unsigned int  textureResizes{}; //!< Number of times the texture was enlarged to make room for glyphs
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the usage of the glyph cache
+    ///
+    /// \see `getCacheStatistics`, `setMemoryBudget`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CacheStatistics
+    {
+        std::uint64_t hits{};          //!< Number of glyph requests served from the cache
+        std::uint64_t misses{};        //!< Number of glyph requests that had to rasterize the glyph
+        std::uint64_t evictions{};     //!< Number of glyphs dropped from the cache to stay within the memory budget
+        std::size_t   residentBytes{}; //!< Size of all the page textures, in bytes
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -233,6 +288,51 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] const Glyph& getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a set of glyphs in advance
+    ///
+    /// Loading a glyph with `getGlyph` uploads its pixels to the
+    /// page texture right away, so displaying a lot of new text
+    /// at once results in many small texture uploads. This function
+    /// instead rasterizes all the glyphs into a copy of the page
+    /// kept in system memory, and uploads the modified part of
+    /// the page texture only once.
+    ///
+    /// This is useful on loading screens or when switching the
+    /// language of an application, when the characters that will
+    /// be displayed are known in advance. Glyphs that are already
+    /// loaded are left untouched.
+    ///
+    /// The glyphs can be rasterized on several threads, see
+    /// `setRasterizationThreads`.
+    ///
+    /// \param codePoints       Unicode code points of the characters to load
+    /// \param characterSize    Reference character size
+    /// \param bold             Load the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    ///
+    /// \see `getGlyph`, `setRasterizationThreads`
+    ///
+    ////////////////////////////////////////////////////////////
+    void preloadGlyphs(std::u32string_view codePoints, unsigned int characterSize, bool bold = false, float outlineThickness = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a range of glyphs in advance
+    ///
+    /// This overload loads all the characters from `first` to
+    /// `last` inclusive, with a single texture upload per page.
+    ///
+    /// \param first            Unicode code point of the first character to load
+    /// \param last             Unicode code point of the last character to load
+    /// \param characterSize    Reference character size
+    /// \param bold             Load the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    ///
+    /// \see `getGlyph`
+    ///
+    ////////////////////////////////////////////////////////////
+    void preloadGlyphs(char32_t first, char32_t last, unsigned int characterSize, bool bold = false, float outlineThickness = 0) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Determine if this font has a glyph representing the requested code point
     ///
@@ -260,6 +360,9 @@ public:
     /// closer than other characters. Most of the glyphs pairs have a
     /// kerning offset of zero, though.
     ///
+    /// The kerning of each pair is cached per character size, so
+    /// laying out text made of pairs already seen is cheap.
+    ///
     /// \param first         Unicode code point of the first character
     /// \param second        Unicode code point of the second character
     /// \param characterSize Reference character size
@@ -352,7 +455,223 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the algorithm used to pack glyphs into page textures
+    ///
+    /// The skyline packer wastes much less texture space than
+    /// the row packer when glyphs of very different heights
+    /// share a page, which is common with mixed-size fonts and
+    /// CJK scripts. Page textures then need to be enlarged less
+    /// often, and each enlargement copies the whole texture.
+    ///
+    /// The algorithm only applies to pages created after this
+    /// call, the glyphs already loaded keep their position.
+    /// The default algorithm is `PackingAlgorithm::Skyline`.
+    ///
+    /// \param algorithm Packing algorithm
+    ///
+    /// \see `getPackingAlgorithm`, `getPageStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPackingAlgorithm(PackingAlgorithm algorithm);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the algorithm used to pack glyphs into page textures
+    ///
+    /// \return Packing algorithm
+    ///
+    /// \see `setPackingAlgorithm`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] PackingAlgorithm getPackingAlgorithm() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get statistics about the texture holding the glyphs of a certain size
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \return Usage statistics of the page texture
+    ///
+    /// \see `getTexture`, `setPackingAlgorithm`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] PageStatistics getPageStatistics(unsigned int characterSize) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of threads used to rasterize preloaded glyphs
+    ///
+    /// When more than one thread is used, `preloadGlyphs`
+    /// rasterizes the missing glyphs concurrently, which greatly
+    /// reduces the time needed to preload large sets of glyphs
+    /// such as CJK characters. Each additional thread uses its
+    /// own FreeType face, opened over an in-memory copy of the
+    /// font data the first time it is needed, and closed when
+    /// the number of threads is reduced. The glyphs are still
+    /// packed into the page texture by the calling thread, at
+    /// the same place as with a single thread.
+    ///
+    /// `getGlyph` always loads glyphs on the calling thread.
+    /// The default number of threads is 1.
+    ///
+    /// \param count Number of threads, including the calling thread (0 is treated as 1)
+    ///
+    /// \see `getRasterizationThreads`, `preloadGlyphs`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRasterizationThreads(unsigned int count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads used to rasterize preloaded glyphs
+    ///
+    /// \return Number of threads, including the calling thread
+    ///
+    /// \see `setRasterizationThreads`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getRasterizationThreads() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the representation of the glyphs stored in page textures
+    ///
+    /// In bitmap mode, every character size has its own page
+    /// texture, and its glyphs are rasterized at that exact size.
+    /// This gives the best quality at small sizes, but texture
+    /// memory and rasterization work grow with every size used.
+    ///
+    /// In signed distance field mode, glyphs are rasterized once
+    /// at a reference size of 64 pixels and stored as distance
+    /// fields in a single page texture, which is shared by all
+    /// character sizes. `sf::Text` renders them with a built-in
+    /// shader, so that their edges stay sharp when scaled. The
+    /// metrics returned by `getGlyph` are scaled to the requested
+    /// character size. Outlines are limited to 8 pixels at the
+    /// reference size, and scale with the character size.
+    ///
+    /// Distance fields require shaders (see `sf::Shader::isAvailable`)
+    /// and a scalable font. The smooth filter is always enabled
+    /// on the distance field page, and glyphs are never rasterized
+    /// on several threads in this mode.
+    ///
+    /// Both modes keep their own pages, so switching back and
+    /// forth doesn't discard any glyph.
+    /// The default mode is `GlyphMode::Bitmap`.
+    ///
+    /// \param mode Representation of the glyphs
+    ///
+    /// \see `getGlyphMode`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGlyphMode(GlyphMode mode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the representation of the glyphs stored in page textures
+    ///
+    /// \return Representation of the glyphs
+    ///
+    /// \see `setGlyphMode`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] GlyphMode getGlyphMode() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum amount of texture memory used by the glyph pages
+    ///
+    /// Glyph pages only ever grow, so a font used with many
+    /// character sizes in a long-running application can end up
+    /// holding a lot of texture memory. When a budget is set, the
+    /// least recently used pages are evicted whenever a page is
+    /// created or enlarged beyond it. If a single page can't be
+    /// enlarged within the budget, it is cleared and its glyphs
+    /// are packed again as they are requested.
+    ///
+    /// Evicting glyphs invalidates the references returned by
+    /// `getGlyph` and `getTexture`, which must therefore not be
+    /// kept across calls to the font. `sf::Text` handles this
+    /// automatically, and flushes the pending draws of the render
+    /// target it is drawn to before its glyphs are looked up again.
+    /// Draws of the font textures still pending in other render
+    /// targets must be flushed with `sf::RenderTarget::flushBatch`
+    /// before glyphs are requested from the font, and a
+    /// `sf::RenderCommandList` must be recorded again once the
+    /// glyphs it draws were evicted. The budget should be
+    /// large enough to hold all the glyphs displayed at once,
+    /// otherwise they keep being evicted and rasterized again.
+    ///
+    /// The glyph indices and kerning values cached by the font
+    /// are dropped whenever pages are evicted, so that they don't
+    /// keep growing outside of the budget.
+    ///
+    /// The budget applies immediately.
+    /// The default budget is 0, which means unlimited.
+    ///
+    /// \param bytes Maximum size of all the page textures, in bytes (0 for unlimited)
+    ///
+    /// \see `getMemoryBudget`, `getCacheStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMemoryBudget(std::size_t bytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum amount of texture memory used by the glyph pages
+    ///
+    /// \return Maximum size of all the page textures, in bytes (0 for unlimited)
+    ///
+    /// \see `setMemoryBudget`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMemoryBudget() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the counters describing the usage of the glyph cache
+    ///
+    /// The counters are reset when a new font is opened.
+    ///
+    /// \return Usage counters of the glyph cache
+    ///
+    /// \see `setMemoryBudget`, `getPageStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] CacheStatistics getCacheStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the glyph pages to a file
+    ///
+    /// The file contains the metrics of the glyphs loaded so far,
+    /// the layout of each page and the pixels of its texture. It
+    /// can be loaded back with `loadAtlasFromFile` on a later run,
+    /// to display the same text without rasterizing its glyphs again.
+    ///
+    /// Only the pages of the bitmap glyph mode are saved.
+    ///
+    /// \param filename Path of the file to save
+    ///
+    /// \return `true` if saving was successful
+    ///
+    /// \see `loadAtlasFromFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool saveAtlasToFile(const std::filesystem::path& filename) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load glyph pages previously saved to a file
+    ///
+    /// The font must already be open, and must be the one the
+    /// atlas was saved from. The pages of the file replace the
+    /// pages of the same character sizes, and the glyphs missing
+    /// from them are still rasterized when first requested.
+    ///
+    /// \param filename Path of the file to load
+    ///
+    /// \return `true` if loading was successful
+    ///
+    /// \see `saveAtlasToFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadAtlasFromFile(const std::filesystem::path& filename);
+
 private:
+    friend class Text;
+
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a row of glyphs
     ///
@@ -368,6 +687,17 @@ private:
         unsigned int height;  //!< Height of the row
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Horizontal segment of the skyline of a page
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SkylineNode
+    {
+        unsigned int x;     //!< X position of the left end of the segment
+        unsigned int y;     //!< Y position of the free space above the segment
+        unsigned int width; //!< Width of the segment
+    };
+
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
@@ -379,14 +709,35 @@ private:
     ////////////////////////////////////////////////////////////
     struct Page
     {
-        explicit Page(bool smooth);
+        Page(bool smooth, PackingAlgorithm algorithm);
 
-        GlyphTable       glyphs;     //!< Table mapping code points to their corresponding glyph
-        Texture          texture;    //!< Texture containing the pixels of the glyphs
-        unsigned int     nextRow{3}; //!< Y position of the next new row in the texture
-        std::vector<Row> rows;       //!< List containing the position of all the existing rows
+        GlyphTable                glyphs;           //!< Table mapping code points to their corresponding glyph
+        Texture                   texture;          //!< Texture containing the pixels of the glyphs
+        PackingAlgorithm          packingAlgorithm; //!< Algorithm used to pack the glyphs into the texture
+        unsigned int              nextRow{3};       //!< Y position of the next new row in the texture
+        std::vector<Row>          rows;             //!< List containing the position of all the existing rows
+        std::vector<SkylineNode>  skyline;          //!< Segments of the skyline, from left to right
+        std::size_t               packedGlyphs{};   //!< Number of glyphs packed into the texture
+        std::uint64_t             usedArea{};       //!< Area covered by the packed glyphs, in pixels
+        unsigned int              textureResizes{}; //!< Number of times the texture was enlarged
+        std::vector<std::uint8_t> alpha;            //!< Copy of the alpha channel of the texture
+        bool                      staging{};        //!< Are the modified rows uploaded at the end of a preload?
+        unsigned int              stagingTop{};     //!< Y position of the first staged row that was modified
+        unsigned int              stagingBottom{};  //!< Y position past the last staged row that was modified
+        std::uint64_t             lastUse{};        //!< Value of the use counter when the page was last used
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Check that the packing state of a page loaded from an atlas fits its texture
+    ///
+    /// \param page Page of glyphs to check
+    /// \param size Size of the page texture
+    ///
+    /// \return `true` if the rows, the skyline and the glyphs all lie within the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isPageConsistent(const Page& page, Vector2u size);
+
     ////////////////////////////////////////////////////////////
     /// \brief Free all the internal resources
     ///
@@ -409,6 +760,57 @@ private:
     ////////////////////////////////////////////////////////////
     Page& loadPage(unsigned int characterSize) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve a glyph of the distance field page, scaled to a character size
+    ///
+    /// \param codePoint        Unicode code point of the character to get
+    /// \param characterSize    Reference character size
+    /// \param bold             Retrieve the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline
+    ///
+    /// \return The glyph corresponding to `codePoint` and `characterSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    const Glyph& getDistanceFieldGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a new glyph as a distance field at the reference size
+    ///
+    /// \param codePoint Unicode code point of the character to load
+    /// \param bold      Retrieve the bold version or the regular one?
+    ///
+    /// \return The glyph corresponding to `codePoint`, at the reference size
+    ///
+    ////////////////////////////////////////////////////////////
+    Glyph loadDistanceFieldGlyph(char32_t codePoint, bool bold) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader turning distance field glyphs into sharp glyphs
+    ///
+    /// \param characterSize    Reference character size
+    /// \param outlineThickness Thickness of outline (when != 0 the outline is drawn instead of the glyph)
+    ///
+    /// \return Shader to draw the glyphs with, or a null pointer if
+    ///         not in distance field mode or shaders are not available
+    ///
+    ////////////////////////////////////////////////////////////
+    const Shader* getDistanceFieldShader(unsigned int characterSize, float outlineThickness) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the padding left around the texture rectangle of the glyphs
+    ///
+    /// Quads drawn around the glyphs must not sample their
+    /// texture further than this, or they would pick up the
+    /// pixels of the neighboring glyphs.
+    ///
+    /// \param characterSize    Reference character size
+    /// \param outlineThickness Thickness of outline
+    ///
+    /// \return Padding on each side of the texture rectangle, in texels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getGlyphTexturePadding(unsigned int characterSize, float outlineThickness) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Load a new glyph and store it in the cache
     ///
@@ -422,6 +824,36 @@ private:
     ////////////////////////////////////////////////////////////
     Glyph loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize the missing glyphs of a page on several threads and store them in the cache
+    ///
+    /// \param page             Page of glyphs to fill, its character size must be the current one
+    /// \param codePoints       Unicode code points of the characters to load
+    /// \param characterSize    Reference character size
+    /// \param bold             Retrieve the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    ///
+    ////////////////////////////////////////////////////////////
+    void loadGlyphsConcurrently(Page&               page,
+                                std::u32string_view codePoints,
+                                unsigned int        characterSize,
+                                bool                bold,
+                                float               outlineThickness) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pack a rasterized glyph into a page and write its pixels
+    ///
+    /// \param page    Page of glyphs to write to
+    /// \param glyph   Metrics of the glyph
+    /// \param size    Size of the glyph's pixels, padding included
+    /// \param padding Size of the padding on each side of the glyph's pixels
+    /// \param pixels  RGBA pixels of the glyph
+    ///
+    /// \return The glyph with its texture rectangle
+    ///
+    ////////////////////////////////////////////////////////////
+    Glyph writeGlyph(Page& page, Glyph glyph, Vector2u size, unsigned int padding, const std::uint8_t* pixels) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Find a suitable rectangle within the texture for a glyph
     ///
@@ -433,6 +865,77 @@ private:
     ////////////////////////////////////////////////////////////
     IntRect findGlyphRect(Page& page, Vector2u size) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a rectangle for a glyph on the rows of a page
+    ///
+    /// \param page Page of glyphs to search in
+    /// \param size Width and height of the rectangle
+    ///
+    /// \return Found rectangle within the texture, or `std::nullopt` if the page is full
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<IntRect> findRowRect(Page& page, Vector2u size) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a rectangle for a glyph on the skyline of a page
+    ///
+    /// \param page Page of glyphs to search in
+    /// \param size Width and height of the rectangle
+    ///
+    /// \return Found rectangle within the texture, or `std::nullopt` if the page is full
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<IntRect> findSkylineRect(Page& page, Vector2u size) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start writing the glyphs of a page to its copy of the alpha channel only
+    ///
+    /// \param page Page of glyphs to stage
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginStaging(Page& page) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the rows of a page modified since `beginStaging` to its texture
+    ///
+    /// \param page Page of glyphs to upload
+    ///
+    ////////////////////////////////////////////////////////////
+    void endStaging(Page& page) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Evict the least recently used pages until the memory budget allows some more bytes
+    ///
+    /// \param keep       Page that must not be evicted, can be a null pointer
+    /// \param extraBytes Number of bytes that are about to be allocated
+    ///
+    ////////////////////////////////////////////////////////////
+    void evictPages(const Page* keep, std::size_t extraBytes) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Drop all the glyphs of a page and give it back its initial texture
+    ///
+    /// \param page Page of glyphs to reset
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetPage(Page& page) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Drop the cached glyph indices and kerning values
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearLookups() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make the texture of a page 2 times bigger
+    ///
+    /// \param page Page of glyphs to enlarge
+    ///
+    /// \return `true` on success, `false` if the maximum texture size was reached or an error happened
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool resizePage(Page& page) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Make sure that the given size is the current one
     ///
@@ -443,19 +946,48 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool setCurrentSize(unsigned int characterSize) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the index of the glyph of a character in the font
+    ///
+    /// The indices are cached, so the font is only queried
+    /// once per code point.
+    ///
+    /// \param codePoint Unicode code point of the character
+    ///
+    /// \return Index of the glyph, 0 if the font has no glyph for this character
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint32_t getGlyphIndex(char32_t codePoint) const;
+
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
     struct FontHandles;
     using PageTable = std::unordered_map<unsigned int, Page>; //!< Table mapping a character size to its page (texture)
+    using ScaledGlyphTable = std::unordered_map<unsigned int, GlyphTable>; //!< Table mapping a character size to its scaled distance field glyphs
+    using ShaderTable = std::unordered_map<int, std::shared_ptr<Shader>>; //!< Table mapping a quantized threshold to its distance field shader
+    using GlyphIndexTable = std::unordered_map<char32_t, std::uint32_t>; //!< Table mapping a code point to its glyph index
+    using KerningTable = std::unordered_map<std::uint64_t, float>; //!< Table mapping a pair of code points to their kerning
+    using KerningPageTable = std::unordered_map<std::uint64_t, KerningTable>; //!< Table mapping a character size and a bold flag to their kerning values
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     std::shared_ptr<FontHandles> m_fontHandles;    //!< Shared information about the internal font instance
     bool                         m_isSmooth{true}; //!< Status of the smooth filter
-    Info                         m_info;           //!< Information about the font
-    mutable PageTable            m_pages;          //!< Table containing the glyphs pages by character size
+    PackingAlgorithm             m_packingAlgorithm{PackingAlgorithm::Skyline}; //!< Packing algorithm of new pages
+    unsigned int                 m_rasterizationThreads{1}; //!< Number of threads used to rasterize preloaded glyphs
+    GlyphMode                    m_glyphMode{GlyphMode::Bitmap}; //!< Representation of the glyphs in page textures
+    Info                         m_info;                         //!< Information about the font
+    mutable PageTable            m_pages;                //!< Table containing the glyphs pages by character size
+    mutable std::optional<Page>  m_distanceFieldPage;    //!< Distance field glyphs rasterized at the reference size
+    mutable ScaledGlyphTable     m_distanceFieldGlyphs;  //!< Distance field glyphs scaled to each character size
+    mutable ShaderTable          m_distanceFieldShaders; //!< Shaders rendering distance field glyphs, by threshold
+    mutable GlyphIndexTable      m_glyphIndices;         //!< Glyph indices of the code points already looked up
+    mutable KerningPageTable     m_kernings;             //!< Kerning values already looked up, by size and boldness
+    std::size_t                  m_memoryBudget{};       //!< Maximum bytes of page textures, 0 for unlimited
+    mutable std::uint64_t        m_pageUses{};           //!< Counter incremented every time a page is used
+    mutable CacheStatistics      m_cacheStatistics;      //!< Usage counters of the glyph cache
     mutable std::vector<std::uint8_t> m_pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
     std::shared_ptr<InputStream> m_stream; //!< Stream for openFromFile and openFromMemory
 };
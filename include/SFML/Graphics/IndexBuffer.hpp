@@ -0,0 +1,393 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Index buffer storage used to draw a vertex buffer with shared vertices
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API IndexBuffer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Types of the indices stored in the buffer
+    ///
+    /// 16-bit indices use half the memory of 32-bit ones, but
+    /// can only address the first 65536 vertices of a vertex buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Type
+    {
+        UInt16, //!< 16-bit unsigned indices
+        UInt32  //!< 32-bit unsigned indices
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// \see `sf::VertexBuffer::Usage`
+    ///
+    ////////////////////////////////////////////////////////////
+    using Usage = VertexBuffer::Usage;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty index buffer of 16-bit indices.
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an `IndexBuffer` with a specific index type
+    ///
+    /// Creates an empty index buffer and sets its index type to \p type.
+    ///
+    /// \param type Type of the indices
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IndexBuffer(Type type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an `IndexBuffer` with a specific usage specifier
+    ///
+    /// Creates an empty index buffer and sets its usage to \p usage.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IndexBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an `IndexBuffer` with a specific index type and usage specifier
+    ///
+    /// Creates an empty index buffer and sets its index type
+    /// to \p type and usage to \p usage.
+    ///
+    /// \param type  Type of the indices
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer(Type type, Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer(const IndexBuffer& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~IndexBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the index buffer
+    ///
+    /// Creates the index buffer and allocates enough graphics
+    /// memory to hold `indexCount` indices of the buffer's
+    /// index type. Any previously allocated memory is freed
+    /// in the process.
+    ///
+    /// In order to deallocate previously allocated memory pass 0
+    /// as `indexCount`. Don't forget to recreate with a non-zero
+    /// value when graphics memory should be allocated again.
+    ///
+    /// \param indexCount Number of indices worth of memory to allocate
+    ///
+    /// \return `true` if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t indexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the index count
+    ///
+    /// \return Number of indices in the index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getIndexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole buffer from an array of 16-bit indices
+    ///
+    /// The index array is assumed to have the same size as
+    /// the created buffer, and the buffer must hold 16-bit
+    /// indices.
+    ///
+    /// \param indices Array of indices to copy to the buffer
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const std::uint16_t* indices);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole buffer from an array of 32-bit indices
+    ///
+    /// The index array is assumed to have the same size as
+    /// the created buffer, and the buffer must hold 32-bit
+    /// indices.
+    ///
+    /// \param indices Array of indices to copy to the buffer
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const std::uint32_t* indices);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of 16-bit indices
+    ///
+    /// `offset` is specified as the number of indices to skip
+    /// from the beginning of the buffer. The same resizing rules
+    /// as `sf::VertexBuffer::update` apply.
+    ///
+    /// The update fails if the buffer doesn't hold 16-bit indices.
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const std::uint16_t* indices, std::size_t indexCount, unsigned int offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of 32-bit indices
+    ///
+    /// `offset` is specified as the number of indices to skip
+    /// from the beginning of the buffer. The same resizing rules
+    /// as `sf::VertexBuffer::update` apply.
+    ///
+    /// The update fails if the buffer doesn't hold 32-bit indices.
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const std::uint32_t* indices, std::size_t indexCount, unsigned int offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy the contents of another buffer into this buffer
+    ///
+    /// Both buffers must hold indices of the same type.
+    ///
+    /// \param indexBuffer Index buffer whose contents to copy into this index buffer
+    ///
+    /// \return `true` if the copy was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const IndexBuffer& indexBuffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer& operator=(const IndexBuffer& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the contents of this index buffer with those of another
+    ///
+    /// \param right Instance to swap with
+    ///
+    ////////////////////////////////////////////////////////////
+    void swap(IndexBuffer& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the index buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the index buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the type of the indices stored in the buffer
+    ///
+    /// The index type is chosen at construction and can't be
+    /// changed afterwards.
+    ///
+    /// \return Index type
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Type getType() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this index buffer
+    ///
+    /// After changing the usage specifier, the index buffer has
+    /// to be updated with new data for the usage specifier to
+    /// take effect.
+    ///
+    /// The default usage type is `sf::VertexBuffer::Usage::Stream`.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this index buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind an index buffer for rendering
+    ///
+    /// This function is not part of the graphics API, it mustn't be
+    /// used when drawing SFML entities. It must be used only if you
+    /// mix `sf::IndexBuffer` with OpenGL code.
+    ///
+    /// \param indexBuffer Pointer to the index buffer to bind, can be null to use no index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    static void bind(const IndexBuffer* indexBuffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports index buffers
+    ///
+    /// Index buffers are available whenever vertex buffers are.
+    ///
+    /// \return `true` if index buffers are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of indices of any type
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool updateData(const void* indices, std::size_t indexCount, unsigned int offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a single index in bytes
+    ///
+    /// \return Size of an index of the buffer's index type
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getIndexSize() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_buffer{};             //!< Internal buffer identifier
+    std::size_t  m_size{};               //!< Size in indices of the currently allocated buffer
+    Type         m_type{Type::UInt16};   //!< Type of the indices
+    Usage        m_usage{Usage::Stream}; //!< How this index buffer is to be used
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Swap the contents of one index buffer with those of another
+///
+/// \param left First instance to swap
+/// \param right Second instance to swap
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void swap(IndexBuffer& left, IndexBuffer& right) noexcept;
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::IndexBuffer
+/// \ingroup graphics
+///
+/// `sf::IndexBuffer` stores, in graphics memory, a list of
+/// indices into a `sf::VertexBuffer`. Drawing a vertex buffer
+/// through an index buffer lets primitives share vertices:
+/// a quad needs 4 vertices and 6 indices instead of 6 full
+/// vertices, which saves memory and upload bandwidth when
+/// drawing large amounts of quads such as tile maps.
+///
+/// Indices can be stored as 16-bit or 32-bit unsigned integers.
+/// 16-bit indices are smaller, but can only address the first
+/// 65536 vertices of a vertex buffer. The index type is chosen
+/// at construction, and `update` must be called with indices
+/// of the matching type.
+///
+/// Index buffers are drawn with the primitive type of the
+/// vertex buffer they are drawn with.
+///
+/// Example:
+/// \code
+/// std::vector<sf::Vertex> vertices;   // 4 vertices per tile
+/// std::vector<std::uint16_t> indices; // 6 indices per tile
+/// ...
+/// sf::VertexBuffer tileVertices(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static);
+/// tileVertices.create(vertices.size());
+/// tileVertices.update(vertices.data());
+///
+/// sf::IndexBuffer tileIndices(sf::IndexBuffer::Type::UInt16, sf::IndexBuffer::Usage::Static);
+/// tileIndices.create(indices.size());
+/// tileIndices.update(indices.data());
+/// ...
+/// window.draw(tileVertices, tileIndices, &tileset);
+/// \endcode
+///
+/// \see `sf::VertexBuffer`, `sf::RenderTarget::draw`
+///
+////////////////////////////////////////////////////////////
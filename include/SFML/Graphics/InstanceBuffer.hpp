@@ -0,0 +1,306 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <array>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Storage for the per-instance attributes of an instanced draw
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API InstanceBuffer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Attributes of a single instance
+    ///
+    /// Only the affine part of the instance transform is stored,
+    /// which is all that 2D transforms use, to keep the instances
+    /// small in graphics memory.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SFML_GRAPHICS_API Instance
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief Set the transform applied to the vertices of the instance
+        ///
+        /// \param newTransform New transform
+        ///
+        /// \see `getTransform`
+        ///
+        ////////////////////////////////////////////////////////////
+        void setTransform(const Transform& newTransform);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the transform applied to the vertices of the instance
+        ///
+        /// \return Transform of the instance
+        ///
+        /// \see `setTransform`
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] Transform getTransform() const;
+
+        std::array<float, 6> transform{1, 0, 0, 1, 0, 0}; //!< Linear columns, then translation, of the transform
+        Color                color{Color::White};         //!< Color multiplied with the vertex colors
+        FloatRect            textureRect{{0, 0}, {1, 1}}; //!< Area the texture coordinates are mapped to
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// \see `sf::VertexBuffer::Usage`
+    ///
+    ////////////////////////////////////////////////////////////
+    using Usage = VertexBuffer::Usage;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty instance buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    InstanceBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an `InstanceBuffer` with a specific usage specifier
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit InstanceBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    InstanceBuffer(const InstanceBuffer& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~InstanceBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the instance buffer
+    ///
+    /// Allocates enough memory to hold `instanceCount` instances,
+    /// which are all reset to their default attributes. Graphics
+    /// memory is only allocated if hardware instancing is
+    /// available, see `isAvailable`.
+    ///
+    /// \param instanceCount Number of instances worth of memory to allocate
+    ///
+    /// \return `true` if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t instanceCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the instance count
+    ///
+    /// \return Number of instances in the instance buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getInstanceCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole buffer from an array of instances
+    ///
+    /// The instance array is assumed to have the same size as
+    /// the created buffer.
+    ///
+    /// \param instances Array of instances to copy to the buffer
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const Instance* instances);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of instances
+    ///
+    /// `offset` is specified as the number of instances to skip
+    /// from the beginning of the buffer. The same resizing rules
+    /// as `sf::VertexBuffer::update` apply.
+    ///
+    /// \param instances     Array of instances to copy to the buffer
+    /// \param instanceCount Number of instances to copy
+    /// \param offset        Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const Instance* instances, std::size_t instanceCount, unsigned int offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    InstanceBuffer& operator=(const InstanceBuffer& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the contents of this instance buffer with those of another
+    ///
+    /// \param right Instance to swap with
+    ///
+    ////////////////////////////////////////////////////////////
+    void swap(InstanceBuffer& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the instance buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the instance buffer or 0 if not
+    ///         yet created or if hardware instancing is not available
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this instance buffer
+    ///
+    /// After changing the usage specifier, the instance buffer has
+    /// to be updated with new data for the usage specifier to
+    /// take effect.
+    ///
+    /// The default usage type is `sf::VertexBuffer::Usage::Stream`.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this instance buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports hardware instancing
+    ///
+    /// Instance buffers can always be used: when hardware
+    /// instancing is not available, instanced draws are
+    /// expanded on the CPU instead.
+    ///
+    /// \return `true` if hardware instancing is supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    friend class RenderTarget;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Instance> m_instances;            //!< Copy of the instances, used when they are expanded on the CPU
+    unsigned int          m_buffer{};             //!< Internal buffer identifier
+    Usage                 m_usage{Usage::Stream}; //!< How this instance buffer is to be used
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Swap the contents of one instance buffer with those of another
+///
+/// \param left First instance to swap
+/// \param right Second instance to swap
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void swap(InstanceBuffer& left, InstanceBuffer& right) noexcept;
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::InstanceBuffer
+/// \ingroup graphics
+///
+/// `sf::InstanceBuffer` holds the attributes of every instance
+/// of an instanced draw, see `sf::RenderTarget::drawInstanced`.
+/// An instanced draw renders the same vertex buffer once per
+/// instance, applying each instance's transform, color and
+/// texture rectangle to the vertices:
+/// \li the transform is combined with the transform of the render states
+/// \li the color multiplies the color of the vertices
+/// \li the texture coordinates of the vertices, expected to be in
+///     the [0, 1] range, are mapped to the texture rectangle
+///
+/// The default texture rectangle, {{0, 0}, {1, 1}}, leaves the
+/// texture coordinates of the vertices unchanged.
+///
+/// When hardware instancing is available, the instances are
+/// stored in graphics memory and the whole draw is issued in
+/// a single call. Otherwise, or when a custom shader is used,
+/// the instances are expanded into vertices on the CPU.
+///
+/// Example:
+/// \code
+/// sf::VertexBuffer quad(sf::PrimitiveType::TriangleStrip, sf::VertexBuffer::Usage::Static);
+/// ... // 4 vertices with texture coordinates in [0, 1]
+///
+/// std::vector<sf::InstanceBuffer::Instance> particles(10000);
+/// ...
+/// sf::InstanceBuffer instances;
+/// instances.create(particles.size());
+/// instances.update(particles.data());
+/// ...
+/// window.drawInstanced(quad, instances, &particleTexture);
+/// \endcode
+///
+/// \see `sf::VertexBuffer`, `sf::RenderTarget::drawInstanced`
+///
+////////////////////////////////////////////////////////////
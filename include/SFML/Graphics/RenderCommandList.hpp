@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <array>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class IndexBuffer;
+class InstanceBuffer;
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Recorded sequence of draw calls that can be replayed
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderCommandList : public Drawable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the recorded commands
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the command list is empty
+    ///
+    /// \return `true` if no command was recorded
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEmpty() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of recorded commands
+    ///
+    /// Compatible draw calls are merged while recording, so
+    /// this is the number of draw calls issued on replay,
+    /// which can be much smaller than the number of recorded
+    /// draw calls.
+    ///
+    /// \return Number of commands
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCommandCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of vertices owned by the command list
+    ///
+    /// Vertices drawn from vertex buffers are not copied,
+    /// and are therefore not included in this count.
+    ///
+    /// \return Number of vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getVertexCount() const;
+
+private:
+    friend class RenderTarget;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record pre-transformed vertices
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives, must be a list type
+    /// \param states      Render states to use for drawing, with an identity transform
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordVertices(const Vertex*       vertices,
+                        std::size_t         vertexCount,
+                        PrimitiveType       type,
+                        const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a draw from a vertex buffer
+    ///
+    /// \param vertexBuffer   Vertex buffer to draw
+    /// \param indexBuffer    Index buffer to draw with, or a null pointer
+    /// \param instanceBuffer Instance buffer to draw with, or a null pointer
+    /// \param first          Index of the first vertex or index to draw
+    /// \param count          Number of vertices or indices to draw
+    /// \param states         Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordBuffer(const VertexBuffer&   vertexBuffer,
+                      const IndexBuffer*    indexBuffer,
+                      const InstanceBuffer* instanceBuffer,
+                      std::size_t           first,
+                      std::size_t           count,
+                      const RenderStates&   states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the recorded vertices to graphics memory
+    ///
+    /// The vertices stay in system memory if vertex buffers
+    /// are not available.
+    ///
+    ////////////////////////////////////////////////////////////
+    void upload();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replay the recorded commands to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recorded draw call
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Command
+    {
+        const VertexBuffer*   vertexBuffer{};   //!< Recorded vertex buffer, null for vertices owned by the list
+        const IndexBuffer*    indexBuffer{};    //!< Recorded index buffer, if any
+        const InstanceBuffer* instanceBuffer{}; //!< Recorded instance buffer, if any
+        PrimitiveType         type{};           //!< Primitive type of the vertices owned by the list
+        std::size_t           first{};          //!< Index of the first vertex or index to draw
+        std::size_t           count{};          //!< Number of vertices or indices to draw
+        RenderStates          states;           //!< Render states to use for drawing
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Vertices owned by the list, for a single primitive type
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Geometry
+    {
+        std::vector<Vertex> vertices; //!< Vertices in system memory, released once uploaded
+        VertexBuffer        buffer;   //!< Vertices in graphics memory
+        std::size_t         count{};  //!< Number of vertices
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Command>    m_commands; //!< Recorded draw calls
+    std::array<Geometry, 3> m_geometry; //!< Vertices owned by the list, for points, lines and triangles
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderCommandList
+/// \ingroup graphics
+///
+/// `sf::RenderCommandList` stores a sequence of draw calls so
+/// that parts of a scene that don't change from one frame to
+/// the next, such as a static background or UI decorations,
+/// can be drawn again without going through the individual
+/// drawables.
+///
+/// Commands are recorded by any render target, between calls
+/// to `sf::RenderTarget::beginRecording` and
+/// `sf::RenderTarget::endRecording`. While recording, the
+/// draw calls of the render target are stored in the command
+/// list instead of being executed. Vertices are transformed
+/// on the CPU and compatible draw calls are merged together,
+/// exactly like automatic batching does (see
+/// `sf::RenderTarget::setBatchingEnabled`). When the recording
+/// ends, the merged vertices are uploaded once to graphics
+/// memory.
+///
+/// The command list is a drawable, and can be replayed to any
+/// render target with a single call to `draw`. Replaying
+/// issues one draw call per merged command, using the view of
+/// the render target it is drawn to. The transform passed to
+/// `draw` is combined with the recorded transforms, but the
+/// other recorded render states are kept unchanged.
+///
+/// Draws from vertex, index or instance buffers are recorded
+/// by reference: the buffers, as well as the textures and
+/// shaders used by the recorded render states, must stay
+/// alive as long as the command list is replayed. To update
+/// the recorded content, simply record it again.
+///
+/// Example:
+/// \code
+/// sf::RenderCommandList background;
+///
+/// window.beginRecording(background);
+/// window.draw(sky);
+/// for (const sf::Sprite& tree : trees)
+///     window.draw(tree);
+/// window.endRecording();
+///
+/// while (window.isOpen())
+/// {
+///     ...
+///     window.clear();
+///     window.draw(background);
+///     window.draw(player);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see `sf::RenderTarget::beginRecording`
+///
+////////////////////////////////////////////////////////////
@@ -39,9 +39,13 @@
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/View.hpp>
 
+#include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 
-#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -50,11 +54,20 @@
 namespace sf
 {
 class Drawable;
+class IndexBuffer;
+class InstanceBuffer;
+class RenderCommandList;
 class Shader;
 class Texture;
 class Transform;
 class VertexBuffer;
 
+namespace priv
+{
+class CoreRenderBackend;
+class GpuProfiler;
+} // namespace priv
+
 ////////////////////////////////////////////////////////////
 /// \brief Base class for all render targets (window, texture, ...)
 ///
@@ -62,11 +75,66 @@ class VertexBuffer;
 class SFML_GRAPHICS_API RenderTarget
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief OpenGL pipeline used to render
+    ///
+    /// \see `setBackend`
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Backend
+    {
+        Automatic,     //!< Core on core profile contexts, fixed-function otherwise
+        FixedFunction, //!< Legacy pipeline with client arrays and the matrix stack
+        Core           //!< Programmable pipeline with vertex array objects and generic attributes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the rendering work of a frame
+    ///
+    /// The batching counters are always updated. The other
+    /// counters are only updated if SFML was built with the
+    /// `SFML_ENABLE_RENDER_STATISTICS` option, otherwise they
+    /// are compiled out and always stay at zero.
+    ///
+    /// \see `getStatistics`, `resetStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::size_t drawCalls{};          //!< Number of draw calls sent to OpenGL
+        std::size_t vertices{};           //!< Number of vertices (or indices) sent to OpenGL, for all instances
+        std::size_t blendModeChanges{};   //!< Number of times the blend mode was applied
+        std::size_t stencilModeChanges{}; //!< Number of times the stencil mode was applied
+        std::size_t textureChanges{};     //!< Number of times a texture was bound or unbound
+        std::size_t shaderChanges{};      //!< Number of times a shader was bound or unbound
+        std::size_t viewChanges{};        //!< Number of times the view was applied
+        std::size_t transformChanges{};   //!< Number of times a transform was loaded
+        std::size_t vertexCacheHits{};    //!< Number of draws pre-transformed in the vertex cache
+        std::size_t submittedDraws{};     //!< Number of draws that went through the batcher
+        std::size_t mergedDraws{};        //!< Number of draws that were merged into a pending batch
+        std::size_t flushedBatches{};     //!< Number of batches actually sent to OpenGL
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Timing of a profile scope
+    ///
+    /// \see `beginProfileScope`, `getProfileResults`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ProfileResult
+    {
+        std::string name;      //!< Name given to `beginProfileScope`
+        std::size_t depth{};   //!< Nesting level of the scope, 0 for the outermost scopes
+        Time        start;     //!< Start of the scope, relative to the first scope of the render target
+        Time        duration;  //!< Time spent in the scope
+        bool        gpuTime{}; //!< Was the scope timed on the GPU, rather than on the CPU?
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
     ////////////////////////////////////////////////////////////
-    virtual ~RenderTarget() = default;
+    virtual ~RenderTarget();
 
     ////////////////////////////////////////////////////////////
     /// \brief Deleted copy constructor
@@ -84,13 +152,13 @@ public:
     /// \brief Move constructor
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget(RenderTarget&&) noexcept = default;
+    RenderTarget(RenderTarget&&) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Move assignment
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget& operator=(RenderTarget&&) noexcept = default;
+    RenderTarget& operator=(RenderTarget&&) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Clear the entire target with a single color
@@ -344,6 +412,67 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and an index buffer
+    ///
+    /// The vertices of the vertex buffer are assembled into
+    /// primitives in the order given by the index buffer, using
+    /// the primitive type of the vertex buffer.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and a range of an index buffer
+    ///
+    /// The vertices of the vertex buffer are assembled into
+    /// primitives in the order given by the index buffer, using
+    /// the primitive type of the vertex buffer.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param firstIndex   Position of the first index to render in the index buffer
+    /// \param indexCount   Number of indices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a vertex buffer once for every instance of an instance buffer
+    ///
+    /// Each instance is drawn with its transform combined with
+    /// the transform of \p states, its color multiplying the
+    /// vertex colors and the texture coordinates of the vertex
+    /// buffer mapped to its texture rectangle.
+    ///
+    /// When hardware instancing is available, all the instances
+    /// are rendered with a single draw call by a built-in shader.
+    /// If \p states holds a shader, or hardware instancing is not
+    /// available, the instances are expanded into vertices on
+    /// the CPU and drawn as a single batch instead.
+    ///
+    /// \param vertexBuffer   Vertex buffer holding the mesh to draw
+    /// \param instanceBuffer Instance buffer holding the attributes of each instance
+    /// \param states         Render states to use for drawing
+    ///
+    /// \see `sf::InstanceBuffer`
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawInstanced(const VertexBuffer&   vertexBuffer,
+                       const InstanceBuffer& instanceBuffer,
+                       const RenderStates&   states = RenderStates::Default);
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -450,12 +579,379 @@ public:
     ////////////////////////////////////////////////////////////
     void resetGLStates();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable automatic batching of draw calls
+    ///
+    /// When batching is enabled, consecutive calls to
+    /// `draw(const Vertex*, std::size_t, PrimitiveType, const RenderStates&)`
+    /// (which is what sprites, shapes, texts and vertex arrays
+    /// use) that share the same texture, shader, blend mode and
+    /// stencil mode are not sent to OpenGL immediately. Their
+    /// vertices are pre-transformed on the CPU and gathered into
+    /// a single buffer, which is drawn in one go when the states
+    /// change, when the view changes, when the target is cleared,
+    /// deactivated or displayed, or when `flushBatch` is called.
+    ///
+    /// Strips and fans are converted to lists while batching,
+    /// so that primitives of different types can share a batch.
+    ///
+    /// Since drawing is deferred, textures and shaders used by
+    /// pending draws must neither be modified nor destroyed until
+    /// the batch is flushed. Call `flushBatch` before changing
+    /// them if needed.
+    ///
+    /// Batching is disabled by default.
+    ///
+    /// \param enabled `true` to enable batching, `false` to disable it
+    ///
+    /// \see `isBatchingEnabled`, `flushBatch`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBatchingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether automatic batching of draw calls is enabled
+    ///
+    /// \return `true` if batching is enabled, `false` otherwise
+    ///
+    /// \see `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isBatchingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the pending batch and deferred draws, if any
+    ///
+    /// This function is called automatically whenever needed,
+    /// you only have to call it yourself before modifying a
+    /// texture or shader used by draws that are still pending,
+    /// or before issuing your own OpenGL commands.
+    ///
+    /// \see `setBatchingEnabled`, `setDeferredDrawingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void flushBatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable deferred, state-sorted drawing
+    ///
+    /// When deferred drawing is enabled, calls to
+    /// `draw(const Vertex*, std::size_t, PrimitiveType, const RenderStates&)`
+    /// are queued instead of being drawn. When the queue is
+    /// flushed (in the same situations as the batch, see
+    /// `setBatchingEnabled`), the queued draws are sorted by
+    /// draw layer first, see `setDrawLayer`, then by render
+    /// states, and sent to the batcher so that draws sharing
+    /// the same states end up in as few draw calls as possible.
+    ///
+    /// Within a layer, a draw is never moved before an earlier
+    /// draw that it overlaps and that uses different states,
+    /// so overlapping translucent primitives are still blended
+    /// in the order they were submitted. Overlaps are detected
+    /// from the bounding rectangles of the transformed vertices.
+    ///
+    /// The queue has the same lifetime requirements as the
+    /// batch: textures and shaders used by queued draws must
+    /// neither be modified nor destroyed until it is flushed.
+    ///
+    /// Deferred drawing is disabled by default.
+    ///
+    /// \param enabled `true` to enable deferred drawing, `false` to disable it
+    ///
+    /// \see `isDeferredDrawingEnabled`, `setDrawLayer`, `flushBatch`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDeferredDrawingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether deferred, state-sorted drawing is enabled
+    ///
+    /// \return `true` if deferred drawing is enabled, `false` otherwise
+    ///
+    /// \see `setDeferredDrawingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDeferredDrawingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the layer of the next deferred draws
+    ///
+    /// Deferred draws of a lower layer are always drawn before
+    /// the ones of a higher layer, whatever their submission
+    /// order. Draws of the same layer keep painter's order
+    /// wherever they overlap.
+    ///
+    /// The default layer is 0.
+    ///
+    /// \param layer New draw layer
+    ///
+    /// \see `getDrawLayer`, `setDeferredDrawingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDrawLayer(int layer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layer of the next deferred draws
+    ///
+    /// \return Current draw layer
+    ///
+    /// \see `setDrawLayer`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] int getDrawLayer() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start recording draw calls into a command list
+    ///
+    /// Until `endRecording` is called, the draw calls issued to
+    /// the render target are not executed but appended to
+    /// `commandList`, which is cleared first. Vertices are
+    /// pre-transformed and compatible draw calls are merged,
+    /// whether automatic batching is enabled or not, so that
+    /// the command list can be replayed with as few draw calls
+    /// as possible.
+    ///
+    /// Only draw calls are recorded: other functions, such as
+    /// `clear` or `setView`, keep affecting the render target
+    /// as usual. The command list must stay alive until the
+    /// recording ends.
+    ///
+    /// \param commandList Command list to record into
+    ///
+    /// \see `endRecording`, `isRecording`
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginRecording(RenderCommandList& commandList);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop recording draw calls
+    ///
+    /// The vertices recorded into the command list are uploaded
+    /// to graphics memory, and draw calls are executed again
+    /// from now on. This function does nothing if the render
+    /// target is not recording.
+    ///
+    /// \see `beginRecording`
+    ///
+    ////////////////////////////////////////////////////////////
+    void endRecording();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether draw calls are being recorded
+    ///
+    /// \return `true` if draw calls are recorded into a command list
+    ///
+    /// \see `beginRecording`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isRecording() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the rendering statistics
+    ///
+    /// The statistics cover a single frame: they accumulate
+    /// until `display` is called, and the first rendering
+    /// work after it starts counting the next frame from zero.
+    /// Reading them right after `display` thus gives the
+    /// totals of the frame that was just displayed. Comparing
+    /// them between builds or content versions helps finding
+    /// regressions in the cost of a frame.
+    ///
+    /// \return Rendering statistics
+    ///
+    /// \see `resetStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Statistics& getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the rendering statistics to zero
+    ///
+    /// This is done automatically at the start of each frame,
+    /// you only need to call it to measure a part of a frame.
+    ///
+    /// \see `getStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start timing a named section of the rendering
+    ///
+    /// Scopes can be nested; each call must be matched by a
+    /// call to `endProfileScope` in the same frame. Scopes that
+    /// are still open when the target is displayed are dropped
+    /// with an error message. The scopes are timed on the
+    /// GPU with OpenGL timer queries, or on the CPU with
+    /// `sf::Clock` if timer queries are not available.
+    ///
+    /// GPU timings are only known once the GPU has executed
+    /// the commands of the scope, typically a few frames later.
+    /// They are read back by `getProfileResults` without ever
+    /// waiting for the GPU.
+    ///
+    /// \code
+    /// window.beginProfileScope("frame");
+    /// window.clear();
+    ///
+    /// window.beginProfileScope("world");
+    /// drawWorld(window);
+    /// window.endProfileScope();
+    ///
+    /// window.beginProfileScope("ui");
+    /// drawUi(window);
+    /// window.endProfileScope();
+    ///
+    /// window.endProfileScope();
+    /// window.display();
+    ///
+    /// for (const auto& result : window.getProfileResults())
+    ///     std::cout << result.name << ": " << result.duration.asMicroseconds() << "us\n";
+    /// \endcode
+    ///
+    /// \param name Name of the scope
+    ///
+    /// \see `endProfileScope`, `getProfileResults`
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginProfileScope(std::string name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop timing the most recently started section of the rendering
+    ///
+    /// \see `beginProfileScope`
+    ///
+    ////////////////////////////////////////////////////////////
+    void endProfileScope();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timings of the profile scopes that became available
+    ///
+    /// Each scope is returned only once, in the order the scopes
+    /// were started. Scopes whose timings are not available yet
+    /// are returned by a later call.
+    ///
+    /// Results are kept until they are retrieved, up to a few
+    /// thousand scopes; beyond that, the oldest ones are dropped
+    /// at the end of each frame.
+    ///
+    /// \return Timings of the scopes
+    ///
+    /// \see `beginProfileScope`, `formatChromeTrace`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<ProfileResult> getProfileResults();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Format profile results in the Chrome trace event format
+    ///
+    /// The resulting JSON document can be loaded in
+    /// `chrome://tracing` or Perfetto to inspect the scopes
+    /// on a timeline.
+    ///
+    /// \param results Results to format
+    ///
+    /// \return JSON document
+    ///
+    /// \see `getProfileResults`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::string formatChromeTrace(const std::vector<ProfileResult>& results);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the size of the vertex cache
+    ///
+    /// Vertex arrays that have at most this number of vertices
+    /// are transformed on the CPU (using SIMD instructions when
+    /// available) and drawn with an identity transform, instead
+    /// of loading their transform into OpenGL. This is faster for
+    /// small arrays such as quads, since it saves a matrix upload,
+    /// but becomes slower than letting the GPU transform the
+    /// vertices as the arrays grow larger.
+    ///
+    /// A size of 0 disables CPU pre-transformation entirely.
+    /// The default size is 4, which covers sprites and quads.
+    ///
+    /// \param size Maximum number of vertices to pre-transform on the CPU
+    ///
+    /// \see `getVertexCacheSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVertexCacheSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the vertex cache
+    ///
+    /// \return Maximum number of vertices pre-transformed on the CPU
+    ///
+    /// \see `setVertexCacheSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getVertexCacheSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the OpenGL pipeline used to render
+    ///
+    /// The fixed-function backend is the historical one: it
+    /// relies on client vertex arrays and on the OpenGL matrix
+    /// stack, which are not available in core profile contexts.
+    ///
+    /// The core backend draws through a vertex array object
+    /// and a built-in GLSL 1.50 program. The view-projection,
+    /// model and texture matrices are passed as the uniforms
+    /// `sf_projectionMatrix`, `sf_modelMatrix` and `sf_textureMatrix`,
+    /// the vertices as the attributes `sf_position`, `sf_color`
+    /// and `sf_texCoords`. It requires OpenGL 3.2; if it is
+    /// unavailable, the fixed-function backend is used instead.
+    ///
+    /// `sf::Shader` relies on `GL_ARB_shader_objects`, which core
+    /// profile contexts don't provide, so custom shaders can only
+    /// be used with the core backend on compatibility profile
+    /// contexts. They then receive the same uniforms and
+    /// attributes, as long as they declare them with these names.
+    ///
+    /// The automatic mode, which is the default, selects the
+    /// core backend on core profile contexts and the
+    /// fixed-function backend on all others.
+    ///
+    /// \param backend Backend to use
+    ///
+    /// \see `getBackend`, `getActiveBackend`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBackend(Backend backend);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the OpenGL pipeline requested to render
+    ///
+    /// \return Requested backend
+    ///
+    /// \see `setBackend`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Backend getBackend() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the OpenGL pipeline actually used to render
+    ///
+    /// This is the backend the last drawing went through, which
+    /// differs from the requested one if the core backend isn't
+    /// available. Before anything is drawn, and after the
+    /// backend is changed, it is only updated by the next draw.
+    ///
+    /// \return Backend::Core or Backend::FixedFunction
+    ///
+    /// \see `setBackend`, `getBackend`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Backend getActiveBackend() const;
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget() = default;
+    RenderTarget();
 
     ////////////////////////////////////////////////////////////
     /// \brief Performs the common initialization step after creation
@@ -466,7 +962,39 @@ protected:
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Finish the current frame
+    ///
+    /// Draws the pending batch and deferred draws, closes the
+    /// statistics of the frame and drops the profile scopes
+    /// that were not ended. The derived classes must
+    /// call this function when their contents are displayed.
+    ///
+    ////////////////////////////////////////////////////////////
+    void finishFrame();
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the current frame for updating
+    ///
+    /// Starts a new frame from zero if the previous one was
+    /// finished by `finishFrame`.
+    ///
+    /// \return Statistics of the current frame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics& getFrameStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Select the backend to use in the active context
+    ///
+    /// The core backend is created the first time it is selected.
+    ///
+    /// \return `true` if the core backend must be used, `false` for the fixed-function one
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool useCoreBackend();
+
     ////////////////////////////////////////////////////////////
     /// \brief Apply the current view
     ///
@@ -514,6 +1042,99 @@ private:
     ////////////////////////////////////////////////////////////
     void applyShader(const Shader* shader);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices, bypassing the batch
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertices(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a range of a vertex buffer, optionally through an index buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer, or null to draw the vertices in order
+    /// \param first        Position of the first vertex (or index if \p indexBuffer is set) to render
+    /// \param count        Number of vertices (or indices if \p indexBuffer is set) to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertexBuffer(const VertexBuffer& vertexBuffer,
+                          const IndexBuffer*  indexBuffer,
+                          std::size_t         first,
+                          std::size_t         count,
+                          const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compile the built-in instancing shader, if not done yet
+    ///
+    /// \return `true` if the shader is ready to be used
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadInstancingProgram();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the instances of an instanced draw in a single draw call
+    ///
+    /// \param vertexBuffer   Vertex buffer holding the mesh to draw
+    /// \param instanceBuffer Instance buffer holding the attributes of each instance
+    /// \param states         Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawInstancedPrimitives(const VertexBuffer&   vertexBuffer,
+                                 const InstanceBuffer& instanceBuffer,
+                                 const RenderStates&   states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Expand the instances of an instanced draw into a batch
+    ///
+    /// \param vertexBuffer   Vertex buffer holding the mesh to draw
+    /// \param instanceBuffer Instance buffer holding the attributes of each instance
+    /// \param states         Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void expandInstances(const VertexBuffer&   vertexBuffer,
+                         const InstanceBuffer& instanceBuffer,
+                         const RenderStates&   states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add primitives to the pending batch
+    ///
+    /// The batch is flushed first if the render states are not
+    /// compatible with the ones of the pending batch.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void addToBatch(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add primitives to the deferred draw queue
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void addToDeferredQueue(const Vertex*       vertices,
+                            std::size_t         vertexCount,
+                            PrimitiveType       type,
+                            const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sort the deferred draws and send them to the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    void flushDeferredQueue();
+
     ////////////////////////////////////////////////////////////
     /// \brief Setup environment for drawing
     ///
@@ -533,6 +1154,20 @@ private:
     ////////////////////////////////////////////////////////////
     void drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the primitives using the bound index buffer
+    ///
+    /// \param type        Type of primitives to draw
+    /// \param indexBuffer Index buffer to read the indices from
+    /// \param firstIndex  Position of the first index to use when drawing
+    /// \param indexCount  Number of indices to use when drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedPrimitives(PrimitiveType      type,
+                               const IndexBuffer& indexBuffer,
+                               std::size_t        firstIndex,
+                               std::size_t        indexCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up environment after drawing
     ///
@@ -547,27 +1182,135 @@ private:
     ////////////////////////////////////////////////////////////
     struct StatesCache
     {
-        bool                  enable{};                //!< Is the cache enabled?
-        bool                  glStatesSet{};           //!< Are our internal GL states set yet?
-        bool                  viewChanged{};           //!< Has the current view changed since last draw?
-        bool                  scissorEnabled{};        //!< Is scissor testing enabled?
-        bool                  stencilEnabled{};        //!< Is stencil testing enabled?
-        BlendMode             lastBlendMode;           //!< Cached blending mode
-        StencilMode           lastStencilMode;         //!< Cached stencil
-        std::uint64_t         lastTextureId{};         //!< Cached texture
-        CoordinateType        lastCoordinateType{};    //!< Texture coordinate type
-        bool                  texCoordsArrayEnabled{}; //!< Is `GL_TEXTURE_COORD_ARRAY` client state enabled?
-        bool                  useVertexCache{};        //!< Did we previously use the vertex cache?
-        std::array<Vertex, 4> vertexCache{};           //!< Pre-transformed vertices cache
+        bool                enable{};                            //!< Is the cache enabled?
+        bool                glStatesSet{};                       //!< Are our internal GL states set yet?
+        bool                viewChanged{};                       //!< Has the current view changed since last draw?
+        bool                scissorEnabled{};                    //!< Is scissor testing enabled?
+        bool                stencilEnabled{};                    //!< Is stencil testing enabled?
+        BlendMode           lastBlendMode;                       //!< Cached blending mode
+        StencilMode         lastStencilMode;                     //!< Cached stencil
+        std::uint64_t       lastTextureId{};                     //!< Cached texture
+        CoordinateType      lastCoordinateType{};                //!< Texture coordinate type
+        bool                texCoordsArrayEnabled{};             //!< Is `GL_TEXTURE_COORD_ARRAY` client state enabled?
+        bool                useVertexCache{};                    //!< Did we previously use the vertex cache?
+        bool                coreBackend{};                       //!< Are the states applied by the core backend?
+        std::vector<Vertex> vertexCache{std::vector<Vertex>(4)}; //!< Pre-transformed vertices cache
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Pending batch of draw calls
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Batch
+    {
+        bool                enabled{};                      //!< Is automatic batching enabled?
+        PrimitiveType       type{PrimitiveType::Triangles}; //!< Primitive type of the pending vertices
+        RenderStates        states;                         //!< Render states shared by the pending vertices
+        std::vector<Vertex> vertices;                       //!< Pre-transformed vertices waiting to be drawn
+        std::vector<Vertex> flushedVertices;                //!< Vertices currently being drawn by `flushBatch`
+        std::vector<Vertex> transformedVertices;            //!< Scratch buffer used to unroll strips and fans
+        std::vector<Vertex> meshVertices;                   //!< Mesh read back to expand instanced draws
+        std::vector<Vertex> instanceVertices;               //!< Scratch buffer used to expand instanced draws
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue of deferred draws, sorted when flushed
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DeferredQueue
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief Queued draw call
+        ///
+        ////////////////////////////////////////////////////////////
+        struct Entry
+        {
+            int           layer{};       //!< Draw layer of the primitives
+            std::size_t   slot{};        //!< Position in the layer, after the overlapped draws it must follow
+            std::size_t   statesIndex{}; //!< Index of the render states of the primitives
+            std::size_t   firstVertex{}; //!< Index of the first vertex of the primitives
+            std::size_t   vertexCount{}; //!< Number of vertices of the primitives
+            PrimitiveType type{};        //!< Type of the primitives
+            FloatRect     bounds;        //!< Bounding rectangle of the transformed vertices
+        };
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Cell of the grid the queued draws are bucketed in
+        ///
+        ////////////////////////////////////////////////////////////
+        struct Cell
+        {
+            int      layer{};  //!< Draw layer of the bucketed draws
+            Vector2i position; //!< Position of the cell in the grid
+
+            [[nodiscard]] bool operator==(const Cell& other) const;
+        };
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Hash function of grid cells
+        ///
+        ////////////////////////////////////////////////////////////
+        struct CellHash
+        {
+            [[nodiscard]] std::size_t operator()(const Cell& cell) const;
+        };
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Hash function of the render states that can share a batch
+        ///
+        ////////////////////////////////////////////////////////////
+        struct StatesHash
+        {
+            [[nodiscard]] std::size_t operator()(const RenderStates& states) const;
+        };
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether two render states can share a batch
+        ///
+        ////////////////////////////////////////////////////////////
+        struct StatesEqual
+        {
+            [[nodiscard]] bool operator()(const RenderStates& left, const RenderStates& right) const;
+        };
+
+        using CellMap   = std::unordered_map<Cell, std::vector<std::size_t>, CellHash>;
+        using StatesMap = std::unordered_map<RenderStates, std::size_t, StatesHash, StatesEqual>;
+
+        bool                      enabled{};       //!< Is deferred drawing enabled?
+        int                       layer{};         //!< Layer of the next queued draws
+        std::vector<Entry>        entries;         //!< Queued draws, in submission order
+        std::vector<Vertex>       vertices;        //!< Pre-transformed vertices of the queued draws
+        std::vector<RenderStates> states;          //!< Distinct render states of the queued draws
+        StatesMap                 statesIndices;   //!< Index of each distinct render states in `states`
+        CellMap                   cells;           //!< Indices of the queued draws overlapping each grid cell
+        std::vector<std::size_t>  largeEntries;    //!< Indices of the queued draws too large to be bucketed
+        std::vector<Entry>        flushedEntries;  //!< Draws currently being sent to the batch
+        std::vector<Vertex>       flushedVertices; //!< Vertices currently being sent to the batch
+        std::vector<RenderStates> flushedStates;   //!< Render states currently being sent to the batch
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Built-in shader used for hardware instancing
+    ///
+    ////////////////////////////////////////////////////////////
+    struct InstancingProgram;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View          m_defaultView; //!< Default view
-    View          m_view;        //!< Current view
-    StatesCache   m_cache{};     //!< Render states cache
-    std::uint64_t m_id{};        //!< Unique number that identifies the RenderTarget
+    View                                     m_defaultView;       //!< Default view
+    View                                     m_view;              //!< Current view
+    StatesCache                              m_cache{};           //!< Render states cache
+    Batch                                    m_batch;             //!< Pending batch of draw calls
+    DeferredQueue                            m_deferredQueue;     //!< Deferred draws, sorted by layer and states
+    Statistics                               m_statistics;        //!< Rendering statistics
+    bool                                     m_frameFinished{};   //!< Was the frame of the statistics displayed?
+    std::unique_ptr<InstancingProgram>       m_instancingProgram; //!< Built-in instancing shader, created on first use
+    Backend                                  m_backend{};         //!< Requested OpenGL pipeline
+    std::unique_ptr<priv::CoreRenderBackend> m_coreBackend;       //!< Core profile pipeline, created on first use
+    std::unique_ptr<priv::GpuProfiler>       m_profiler;          //!< Profile scopes timer, created on first use
+    RenderCommandList*                       m_recording{};       //!< Command list receiving the draw calls, if any
+    std::uint64_t                            m_id{};              //!< Unique number that identifies the RenderTarget
 };
 
 } // namespace sf
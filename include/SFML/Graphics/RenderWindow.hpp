@@ -198,6 +198,18 @@ protected:
     ////////////////////////////////////////////////////////////
     void onResize() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the window is displayed
+    ///
+    /// Draws still pending in the batch are flushed, so that
+    /// `display()` shows them even when called through a
+    /// `sf::Window` reference.
+    ///
+    /// \see `RenderTarget::setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void onDisplay() override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
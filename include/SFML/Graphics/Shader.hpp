@@ -37,14 +37,17 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <cstddef>
+#include <cstdint>
 
 
 namespace sf
 {
 class InputStream;
 class Texture;
+class UniformBuffer;
 
 ////////////////////////////////////////////////////////////
 /// \brief Shader class (vertex, geometry and fragment)
@@ -84,6 +87,68 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static inline CurrentTextureType CurrentTexture;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle to a uniform of a shader
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    class UniformHandle
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Creates an invalid handle, which is ignored when setting uniforms.
+        ///
+        ////////////////////////////////////////////////////////////
+        UniformHandle() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the handle refers to an existing uniform
+        ///
+        /// \return `true` if the uniform was found in the shader
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isValid() const
+        {
+            return m_location != -1;
+        }
+
+    private:
+        friend class Shader;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct the handle from a uniform location
+        ///
+        /// \param program  Unique identifier of the program
+        /// \param location Location of the uniform in the program
+        ///
+        ////////////////////////////////////////////////////////////
+        UniformHandle(std::uint64_t program, int location) : m_program(program), m_location(location)
+        {
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        std::uint64_t m_program{};    //!< Unique identifier of the program the uniform belongs to
+        int           m_location{-1}; //!< Location of the uniform in the program
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the usage of the program binary cache
+    ///
+    /// \see `getBinaryCacheStatistics`, `setBinaryCacheDirectory`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct BinaryCacheStatistics
+    {
+        std::uint64_t hits{};   //!< Number of programs loaded from the cache
+        std::uint64_t misses{}; //!< Number of programs that had to be compiled from source
+        std::uint64_t writes{}; //!< Number of compiled programs stored in the cache
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -778,6 +843,330 @@ public:
     ////////////////////////////////////////////////////////////
     void setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify the buffer holding the values of a uniform block
+    ///
+    /// \p name is the name of a uniform block declared in the
+    /// shader, and \p buffer a uniform buffer whose contents
+    /// follow the layout of the block. The same buffer can be
+    /// used by any number of shaders, its contents only have to
+    /// be updated once for all of them.
+    ///
+    /// \code
+    /// layout(std140) uniform Frame
+    /// {
+    ///     mat4 viewProjection;
+    ///     vec4 time;
+    /// };
+    /// \endcode
+    /// \code
+    /// sf::UniformBuffer frame;
+    /// ...
+    /// shader.setUniformBlock("Frame", frame);
+    /// \endcode
+    ///
+    /// It is important to note that \p buffer must remain alive as long
+    /// as the shader uses it, no copy is made internally.
+    ///
+    /// Nothing is done if uniform buffers are not available,
+    /// see `sf::UniformBuffer::isAvailable`.
+    ///
+    /// \param name   Name of the uniform block in GLSL
+    /// \param buffer Uniform buffer holding the values of the block
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformBlock(const std::string& name, const UniformBuffer& buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary uniform buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformBlock(const std::string& name, const UniformBuffer&& buffer) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable deferred uniform uploads
+    ///
+    /// By default, every call to `setUniform` and `setUniformArray`
+    /// sends the value to the graphics card immediately, which
+    /// requires activating the program and restoring the previous
+    /// one afterwards. When deferred uploads are enabled, the values
+    /// are only stored in the shader, and the ones that changed are
+    /// uploaded the next time the shader is bound, either by
+    /// `bind` or when drawing with it. Setting a uniform to the
+    /// value it already has costs nothing in this mode.
+    ///
+    /// Disabling deferred uploads sends the pending values
+    /// immediately.
+    ///
+    /// Deferred uploads are disabled by default.
+    ///
+    /// \param deferred `true` to defer uniform uploads, `false` to upload them immediately
+    ///
+    /// \see `isUniformUploadDeferred`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformUploadDeferred(bool deferred);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether uniform uploads are deferred
+    ///
+    /// \return `true` if uniforms are uploaded when the shader is bound, `false` otherwise
+    ///
+    /// \see `setUniformUploadDeferred`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isUniformUploadDeferred() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a handle to a uniform, to set it without looking up its name
+    ///
+    /// Setting a uniform by name looks its location up in a
+    /// table every time. When the same uniforms are set very
+    /// often, retrieve their handles once after loading the
+    /// shader and pass them to `setUniform` instead.
+    ///
+    /// Handles are only valid for the program they were
+    /// retrieved from. They must be retrieved again after
+    /// the shader is loaded again.
+    ///
+    /// \param name Name of the uniform variable in GLSL
+    ///
+    /// \return Handle of the uniform, invalid if the shader has no such uniform
+    ///
+    /// \see `setUniform`, `setUniformArray`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] UniformHandle getUniformHandle(std::string_view name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p float uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param x      Value of the float scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, float x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec2 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the vec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, Glsl::Vec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec3 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the vec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec4 uniform
+    ///
+    /// This overload can also be called with `sf::Color` objects
+    /// that are converted to `sf::Glsl::Vec4`.
+    ///
+    /// It is important to note that the components of the color are
+    /// normalized before being passed to the shader. Therefore,
+    /// they are converted from range [0 .. 255] to range [0 .. 1].
+    /// For example, a `sf::Color(255, 127, 0, 255)` will be transformed
+    /// to a `vec4(1.0, 0.5, 0.0, 1.0)` in the shader.
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the vec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p int uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param x      Value of the int scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, int x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec2 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the ivec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, Glsl::Ivec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec3 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the ivec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec4 uniform
+    ///
+    /// This overload can also be called with `sf::Color` objects
+    /// that are converted to `sf::Glsl::Ivec4`.
+    ///
+    /// If color conversions are used, the ivec4 uniform in GLSL
+    /// will hold the same values as the original `sf::Color`
+    /// instance. For example, `sf::Color(255, 127, 0, 255)` is
+    /// mapped to `ivec4(255, 127, 0, 255)`.
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the ivec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bool uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param x      Value of the bool scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, bool x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec2 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the bvec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, Glsl::Bvec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec3 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the bvec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec4 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the bvec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat3 matrix
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param matrix Value of the mat3 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Mat3& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat4 matrix
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param matrix Value of the mat4 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Mat4& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify a texture as \p sampler2D uniform
+    ///
+    /// It is important to note that `texture` must remain alive as long
+    /// as the shader uses it, no copy is made internally.
+    ///
+    /// \param handle  Handle of the texture in the shader
+    /// \param texture Texture to assign
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify current texture as \p sampler2D uniform
+    ///
+    /// \param handle Handle of the texture in the shader
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, CurrentTextureType);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p float[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param scalarArray pointer to array of \p float values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const float* scalarArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec2[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param vectorArray pointer to array of \p vec2 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Vec2* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec3[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param vectorArray pointer to array of \p vec3 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Vec3* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec4[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param vectorArray pointer to array of \p vec4 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Vec4* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p mat3[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param matrixArray pointer to array of \p mat3 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Mat3* matrixArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p mat4[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param matrixArray pointer to array of \p mat4 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Mat4* matrixArray, std::size_t length);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the underlying OpenGL handle of the shader.
     ///
@@ -844,6 +1233,57 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool isGeometryAvailable();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the directory of the program binary cache
+    ///
+    /// Compiling and linking shaders from source can take a
+    /// significant time. When a cache directory is set, each
+    /// linked program is saved there in the driver's binary
+    /// format, and loading the same sources again reads the
+    /// binary back instead of compiling them. Binaries are
+    /// identified by the source code and the vendor, renderer
+    /// and version strings of the driver, so updating either
+    /// automatically falls back to compiling from source.
+    /// Binaries that the driver rejects are also ignored
+    /// and replaced.
+    ///
+    /// The cache requires support for program binaries
+    /// (OpenGL 4.1 or ARB_get_program_binary), it is silently
+    /// unused otherwise.
+    ///
+    /// The cache is disabled by default. Passing an empty path
+    /// disables it again.
+    ///
+    /// \param directory Directory where the program binaries are stored
+    ///
+    /// \see `getBinaryCacheDirectory`, `getBinaryCacheStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setBinaryCacheDirectory(const std::filesystem::path& directory);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the directory of the program binary cache
+    ///
+    /// \return Directory where the program binaries are stored, empty if the cache is disabled
+    ///
+    /// \see `setBinaryCacheDirectory`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::filesystem::path getBinaryCacheDirectory();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage counters of the program binary cache
+    ///
+    /// Only the shaders loaded while the cache is enabled and
+    /// usable are counted.
+    ///
+    /// \return Statistics of the program binary cache since the start of the application
+    ///
+    /// \see `setBinaryCacheDirectory`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static BinaryCacheStatistics getBinaryCacheStatistics();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Compile the shader(s) and create the program
@@ -871,6 +1311,16 @@ private:
     ////////////////////////////////////////////////////////////
     void bindTextures() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the uniform buffers used by the shader
+    ///
+    /// Each uniform block uses the binding point matching its
+    /// index in the program, the buffers are attached to these
+    /// binding points.
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindUniformBlocks() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the location ID of a shader uniform
     ///
@@ -881,6 +1331,88 @@ private:
     ////////////////////////////////////////////////////////////
     int getUniformLocation(const std::string& name);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a handle to a uniform of the current program from its name
+    ///
+    /// \param name Name of the uniform variable to search
+    ///
+    /// \return Handle of the uniform, invalid if not found
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] UniformHandle findUniformHandle(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the location ID of a shader uniform from its handle
+    ///
+    /// \param handle Handle of the uniform variable
+    ///
+    /// \return Location ID of the uniform, or -1 if the handle is invalid or belongs to another program
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] int getUniformLocation(UniformHandle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Types of the uniforms whose upload can be deferred
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class UniformType
+    {
+        Float,
+        Vec2,
+        Vec3,
+        Vec4,
+        Int,
+        Ivec2,
+        Ivec3,
+        Ivec4,
+        Mat3,
+        Mat4
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Value of a uniform stored by the deferred upload mode
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DeferredUniform
+    {
+        UniformType        type{};  //!< Type of the uniform
+        std::size_t        count{}; //!< Number of array elements
+        std::vector<float> floats;  //!< Components of floating point uniforms
+        std::vector<int>   ints;    //!< Components of integer and boolean uniforms
+        bool               dirty{}; //!< Has the value changed since it was last uploaded?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store the value of a floating point uniform until the next bind
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param type   Type of the uniform
+    /// \param values Pointer to the components of the value
+    /// \param size   Total number of components
+    /// \param count  Number of array elements
+    ///
+    ////////////////////////////////////////////////////////////
+    void deferUniform(UniformHandle handle, UniformType type, const float* values, std::size_t size, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store the value of an integer uniform until the next bind
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param type   Type of the uniform
+    /// \param values Pointer to the components of the value
+    /// \param size   Total number of components
+    ///
+    ////////////////////////////////////////////////////////////
+    void deferUniform(UniformHandle handle, UniformType type, const int* values, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the deferred uniforms that changed
+    ///
+    /// The program must be active when this function is called.
+    ///
+    ////////////////////////////////////////////////////////////
+    void uploadDeferredUniforms() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief RAII object to save and restore the program
     ///        binding while uniforms are being set
@@ -893,16 +1425,23 @@ private:
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    using TextureTable = std::unordered_map<int, const Texture*>;
-    using UniformTable = std::unordered_map<std::string, int>;
+    using TextureTable         = std::unordered_map<int, const Texture*>;
+    using UniformTable         = std::unordered_map<std::string, int>;
+    using DeferredUniformTable = std::unordered_map<int, DeferredUniform>;
+    using UniformBlockTable    = std::unordered_map<unsigned int, const UniformBuffer*>;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int m_shaderProgram{};    //!< OpenGL identifier for the program
-    int          m_currentTexture{-1}; //!< Location of the current texture in the shader
-    TextureTable m_textures;           //!< Texture variables in the shader, mapped to their location
-    UniformTable m_uniforms;           //!< Parameters location cache
+    unsigned int                 m_shaderProgram{};    //!< OpenGL identifier for the program
+    std::uint64_t                m_programId{};        //!< Identifier of the program, never reused unlike OpenGL names
+    int                          m_currentTexture{-1}; //!< Location of the current texture in the shader
+    TextureTable                 m_textures;           //!< Texture variables in the shader, mapped to their location
+    UniformTable                 m_uniforms;           //!< Parameters location cache
+    UniformBlockTable            m_uniformBlocks;      //!< Uniform buffers used by the shader, by block index
+    bool                         m_uploadDeferred{};   //!< Are uniform values stored until the next bind?
+    mutable DeferredUniformTable m_deferredUniforms;   //!< Values of the deferred uniforms, mapped to their location
+    mutable std::vector<int>     m_dirtyUniforms;      //!< Locations of the deferred uniforms to upload at next bind
 };
 
 } // namespace sf
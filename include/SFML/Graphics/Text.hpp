@@ -40,6 +40,9 @@
 #include <SFML/System/String.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <optional>
+#include <vector>
+
 #include <cstddef>
 #include <cstdint>
 
@@ -69,6 +72,17 @@ public:
         StrikeThrough = 1 << 3  //!< Strike through characters
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enumeration of the horizontal alignments of the lines
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Alignment
+    {
+        Left,   //!< Lines start at the left of the text
+        Center, //!< Lines are centered
+        Right   //!< Lines end at the right of the text
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the text from a string, font and size
     ///
@@ -106,13 +120,47 @@ public:
     /// \endcode
     /// A text's string is empty by default.
     ///
+    /// Only the lines that differ from the previous string are
+    /// laid out again, so appending to a long text or editing
+    /// a few characters of it is cheap.
+    ///
     /// \param string New string
     ///
-    /// \see `getString`
+    /// \see `getString`, `insertString`, `eraseString`
     ///
     ////////////////////////////////////////////////////////////
     void setString(const String& string);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Insert characters into the text's string
+    ///
+    /// Only the lines around the inserted characters are laid
+    /// out again, the geometry of the other lines is reused.
+    /// This is faster than `setString` as the previous and new
+    /// strings don't have to be compared.
+    ///
+    /// \param position Position of insertion (capped to the size of the string)
+    /// \param string   Characters to insert
+    ///
+    /// \see `setString`, `eraseString`
+    ///
+    ////////////////////////////////////////////////////////////
+    void insertString(std::size_t position, const String& string);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Erase characters from the text's string
+    ///
+    /// Only the lines around the erased characters are laid
+    /// out again, the geometry of the other lines is reused.
+    ///
+    /// \param position Position of the first character to erase (capped to the size of the string)
+    /// \param count    Number of characters to erase
+    ///
+    /// \see `setString`, `insertString`
+    ///
+    ////////////////////////////////////////////////////////////
+    void eraseString(std::size_t position, std::size_t count = 1);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the text's font
     ///
@@ -202,6 +250,42 @@ public:
     ////////////////////////////////////////////////////////////
     void setStyle(std::uint32_t style);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum width of the lines
+    ///
+    /// Lines wider than this are wrapped at the last whitespace
+    /// that fits, or between two characters when a single word
+    /// is too wide. Whitespace at the end of a wrapped line is
+    /// kept on that line.
+    /// The default maximum width is 0, which disables wrapping.
+    ///
+    /// \param maxWidth New maximum width of the lines, in pixels (0 for unlimited)
+    ///
+    /// \see `getMaxWidth`, `setAlignment`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxWidth(float maxWidth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the horizontal alignment of the lines
+    ///
+    /// Lines are aligned within the maximum width if one is set,
+    /// and within the widest line otherwise. Trailing whitespace
+    /// is ignored when aligning a line.
+    /// The default alignment is `sf::Text::Alignment::Left`.
+    ///
+    /// Centered and right aligned lines depend on the widest line
+    /// when there is no maximum width, so modifying the string
+    /// then lays out all the lines again instead of only the
+    /// modified ones.
+    ///
+    /// \param alignment New alignment
+    ///
+    /// \see `getAlignment`, `setMaxWidth`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAlignment(Alignment alignment);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the fill color of the text
     ///
@@ -315,6 +399,26 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint32_t getStyle() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum width of the lines
+    ///
+    /// \return Maximum width of the lines, in pixels (0 for unlimited)
+    ///
+    /// \see `setMaxWidth`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getMaxWidth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the horizontal alignment of the lines
+    ///
+    /// \return Alignment of the lines
+    ///
+    /// \see `setAlignment`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Alignment getAlignment() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the fill color of the text
     ///
@@ -362,6 +466,19 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Vector2f findCharacterPos(std::size_t index) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of lines of the text
+    ///
+    /// Lines are separated by new line characters, and by
+    /// wrapping when a maximum width is set.
+    ///
+    /// \return Number of lines, 0 if the string is empty
+    ///
+    /// \see `setMaxWidth`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getLineCount() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the local bounding rectangle of the entity
     ///
@@ -391,6 +508,46 @@ public:
     [[nodiscard]] FloatRect getGlobalBounds() const;
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Geometry of a line of text
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Line
+    {
+        std::size_t length{};             //!< Number of characters, including the terminating new line
+        bool        newLine{};            //!< Is the line terminated by a new line character, rather than wrapped?
+        std::size_t firstVertex{};        //!< Index of the first vertex of the fill geometry
+        std::size_t vertexCount{};        //!< Number of vertices of the fill geometry
+        std::size_t firstOutlineVertex{}; //!< Index of the first vertex of the outline geometry
+        std::size_t outlineVertexCount{}; //!< Number of vertices of the outline geometry
+        float       y{};                  //!< Vertical position of the line
+        float       translation{};        //!< Vertical translation applied to the vertices when drawing them
+        float       width{};              //!< Width of the line, without its trailing whitespace
+        float       offset{};             //!< Horizontal offset of the line, to align it
+        Vector2f    min;                  //!< Minimum coordinates of the line's bounding rectangle
+        Vector2f    max;                  //!< Maximum coordinates of the line's bounding rectangle
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Range of the string modified since its geometry was updated
+    ///
+    ////////////////////////////////////////////////////////////
+    struct StringEdit
+    {
+        std::size_t begin{}; //!< Position of the first modified character
+        std::size_t end{};   //!< Position past the last modified character, in the current string
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a modification of the string, to update the geometry of the lines around it
+    ///
+    /// \param position Position of the modification
+    /// \param removed  Number of characters removed at `position`
+    /// \param inserted Number of characters inserted at `position`
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordStringEdit(std::size_t position, std::size_t removed, std::size_t inserted);
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the text to a render target
     ///
@@ -409,6 +566,41 @@ private:
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the text's geometry if any of its attributes changed
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateGeometry() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move a line horizontally, to align it
+    ///
+    /// \param line   Line to move
+    /// \param offset New horizontal offset of the line
+    ///
+    ////////////////////////////////////////////////////////////
+    void alignLine(Line& line, float offset) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the lines that can be drawn in a single piece
+    ///
+    /// \param line     Index of the first line of the piece
+    /// \param lastLine Index past the last line that can be part of the piece
+    /// \param outline  Check the outline geometry rather than the fill geometry?
+    ///
+    /// \return Index past the last line of the piece
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t findPieceEnd(std::size_t line, std::size_t lastLine, bool outline) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether partial updates scattered the geometry too much
+    ///
+    /// \return `true` if the lines are drawn in too many pieces or too many vertices are unused
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isGeometryFragmented() const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -418,14 +610,19 @@ private:
     float                 m_letterSpacingFactor{1.f};                  //!< Spacing factor between letters
     float                 m_lineSpacingFactor{1.f};                    //!< Spacing factor between lines
     std::uint32_t         m_style{Regular};                            //!< Text style (see Style enum)
+    float                 m_maxWidth{};                                //!< Maximum width of the lines, 0 for unlimited
+    Alignment             m_alignment{Alignment::Left};                //!< Horizontal alignment of the lines
     Color                 m_fillColor{Color::White};                   //!< Text fill color
     Color                 m_outlineColor{Color::Black};                //!< Text outline color
     float                 m_outlineThickness{0.f};                     //!< Thickness of the text's outline
     mutable VertexArray   m_vertices{PrimitiveType::Triangles};        //!< Vertex array containing the fill geometry
     mutable VertexArray   m_outlineVertices{PrimitiveType::Triangles}; //!< Vertex array containing the outline geometry
-    mutable FloatRect     m_bounds;               //!< Bounding rectangle of the text (in local coordinates)
-    mutable bool          m_geometryNeedUpdate{}; //!< Does the geometry need to be recomputed?
-    mutable std::uint64_t m_fontTextureId{};      //!< The font texture id
+    mutable FloatRect     m_bounds;                 //!< Bounding rectangle of the text (in local coordinates)
+    mutable bool          m_geometryNeedUpdate{};   //!< Does the geometry need to be recomputed?
+    mutable std::uint64_t m_fontTextureId{};        //!< The font texture id
+    mutable std::vector<Line>         m_lines;      //!< Geometry of each line, from top to bottom
+    mutable std::optional<StringEdit> m_stringEdit; //!< Range of the string modified since the geometry was updated
+    mutable Vector2f                  m_lineExtent; //!< Largest extent of the lines above and below their position
 };
 
 } // namespace sf
@@ -36,7 +36,9 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include <array>
 #include <filesystem>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -55,6 +57,211 @@ class Image;
 class SFML_GRAPHICS_API Texture : GlResource
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Pending asynchronous update of a texture
+    ///
+    /// \see `beginUpload`, `submitUpload`
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_GRAPHICS_API Upload : GlResource
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Creates an empty upload, which has no staging memory.
+        ///
+        ////////////////////////////////////////////////////////////
+        Upload() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /// Releases the staging memory. Destroying an upload that
+        /// was not submitted discards its pixels.
+        ///
+        ////////////////////////////////////////////////////////////
+        ~Upload();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Upload(const Upload&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        Upload& operator=(const Upload&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Upload(Upload&& source) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        Upload& operator=(Upload&& right) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the staging memory to fill with pixels
+        ///
+        /// The memory holds `getSize().x * getSize().y` 32-bits
+        /// RGBA pixels. It may be written from any thread, but
+        /// all writes must be finished before the upload is
+        /// submitted, after which the pointer becomes invalid.
+        ///
+        /// \return Pointer to the staging pixels, `nullptr` if the upload is empty or was submitted
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] std::uint8_t* getPixels() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the size of the region being uploaded
+        ///
+        /// \return Size in pixels
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] Vector2u getSize() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the graphics card has finished the upload
+        ///
+        /// This function doesn't block. Drawing the texture after
+        /// submitting the upload already shows the new pixels since
+        /// the graphics driver orders the copy before the draw, so
+        /// polling is only needed to pace streaming, e.g. to start
+        /// the next upload once this one is done.
+        ///
+        /// \return `true` if the upload was submitted and has completed
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isComplete() const;
+
+    private:
+        friend class Texture;
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        unsigned int              m_buffer{};    //!< Pixel buffer object holding the staging pixels, 0 if none
+        std::vector<std::uint8_t> m_fallback;    //!< Staging pixels when pixel buffer objects are not available
+        std::uint8_t*             m_pixels{};    //!< Staging pixels, valid until the upload is submitted
+        Vector2u                  m_size;        //!< Size of the region to update
+        Vector2u                  m_dest;        //!< Destination of the region in the texture
+        mutable void*             m_fence{};     //!< Fence signaled once the upload has completed
+        bool                      m_submitted{}; //!< Has the upload been submitted to the texture?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pending asynchronous copy of a texture to an image
+    ///
+    /// Works like a `std::future<Image>`: the image is retrieved
+    /// once with `get`, after which the readback becomes invalid.
+    ///
+    /// \see `copyToImageAsync`
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_GRAPHICS_API Readback : GlResource
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Creates an invalid readback.
+        ///
+        ////////////////////////////////////////////////////////////
+        Readback() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        ////////////////////////////////////////////////////////////
+        ~Readback();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Readback(const Readback&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        Readback& operator=(const Readback&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Readback(Readback&& source) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        Readback& operator=(Readback&& right) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the readback refers to pixels
+        ///
+        /// \return `true` until `get` has been called on a readback returned by `copyToImageAsync`
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isValid() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the pixels have reached client memory
+        ///
+        /// This function doesn't block. Once it returns `true`,
+        /// `get` no longer waits for the graphics card.
+        ///
+        /// \return `true` if the readback is valid and its pixels are available
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isReady() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Retrieve the image
+        ///
+        /// This function waits for the graphics card if the pixels
+        /// are not ready yet, then removes the padding and undoes
+        /// the flipping of the texture while copying them to the
+        /// image. It can be called from any thread, e.g. to keep
+        /// that work off the render thread.
+        ///
+        /// The readback becomes invalid afterwards.
+        ///
+        /// \return Image containing the texture's pixels, empty if the readback is invalid
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] Image get();
+
+    private:
+        friend class Texture;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Release the pixel buffer object and the fence
+        ///
+        ////////////////////////////////////////////////////////////
+        void release();
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        unsigned int              m_buffer{};   //!< Pixel buffer object receiving the pixels, 0 if none
+        std::vector<std::uint8_t> m_pixels;     //!< Pixels when pixel buffer objects are not available
+        Vector2u                  m_size;       //!< Size of the image
+        Vector2u                  m_actualSize; //!< Size of the pixels read, including the padding of the texture
+        mutable void*             m_fence{};    //!< Fence signaled once the pixels have been written to the buffer
+        bool                      m_flipped{};  //!< Are the pixels flipped vertically?
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -402,6 +609,34 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Image copyToImage() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start copying the texture pixels to an image
+    ///
+    /// Unlike `copyToImage`, this function doesn't wait for the
+    /// graphics card: the pixels are read into a pixel buffer
+    /// object and retrieved later through the returned readback,
+    /// which makes it suitable for periodic captures (e.g. of a
+    /// `sf::RenderTexture`) without stalling the rendering.
+    ///
+    /// The readback captures the texture as it is when this
+    /// function is called. If pixel buffer objects are not
+    /// available, the pixels are copied immediately as with
+    /// `copyToImage`.
+    ///
+    /// \code
+    /// sf::Texture::Readback readback = renderTexture.getTexture().copyToImageAsync();
+    /// ...
+    /// if (readback.isReady())
+    ///     saveThumbnail(readback.get());
+    /// \endcode
+    ///
+    /// \return Pending readback, invalid if the texture is empty
+    ///
+    /// \see `copyToImage`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Readback copyToImageAsync() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the whole texture from an array of pixels
     ///
@@ -440,6 +675,62 @@ public:
     ////////////////////////////////////////////////////////////
     void update(const std::uint8_t* pixels, Vector2u size, Vector2u dest);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start an asynchronous update of a part of the texture
+    ///
+    /// This function allocates staging memory for `size` pixels,
+    /// in a pixel buffer object mapped into client memory when
+    /// the graphics driver supports it. The returned upload can
+    /// then be filled from any thread (e.g. a loading thread)
+    /// through `Upload::getPixels`, and handed back to
+    /// `submitUpload` to update the texture.
+    ///
+    /// Unlike `update`, the pixels are copied to the texture by
+    /// the graphics card, so the render thread doesn't block on
+    /// the transfer. If pixel buffer objects are not available,
+    /// the staging memory lives in client memory and submitting
+    /// the upload falls back to a regular `update`.
+    ///
+    /// No additional check is performed on the bounds of the
+    /// area to update. Passing invalid arguments will lead to
+    /// an undefined behavior.
+    ///
+    /// \code
+    /// sf::Texture::Upload upload = texture.beginUpload(size, dest);
+    /// auto future = std::async(std::launch::async, [&] { decode(upload.getPixels()); });
+    /// ...
+    /// future.wait();
+    /// (void)texture.submitUpload(upload);
+    /// \endcode
+    ///
+    /// \param size Width and height of the pixel region to update
+    /// \param dest Coordinates of the destination position
+    ///
+    /// \return Pending upload, empty if the texture was not previously created
+    ///
+    /// \see `submitUpload`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Upload beginUpload(Vector2u size, Vector2u dest = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy the pixels of an upload to the texture
+    ///
+    /// The upload must have been started with `beginUpload` on
+    /// this texture, and its staging memory must no longer be
+    /// written to. The copy is queued on the graphics card,
+    /// `Upload::isComplete` can be polled to know when it has
+    /// finished.
+    ///
+    /// \param upload Upload to submit
+    ///
+    /// \return `true` if the upload was submitted, `false` if it was empty or already submitted
+    ///
+    /// \see `beginUpload`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool submitUpload(Upload& upload);
+
     ////////////////////////////////////////////////////////////
     /// \brief Update a part of this texture from another texture
     ///
@@ -740,6 +1031,19 @@ private:
     ////////////////////////////////////////////////////////////
     void invalidateMipmap();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the matrix converting texture coordinates to normalized OpenGL coordinates
+    ///
+    /// This takes the coordinate type, the padding added to
+    /// reach a power of two size and flipped pixels into account.
+    ///
+    /// \param coordinateType Type of the texture coordinates
+    ///
+    /// \return 4x4 texture matrix, in column-major order
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::array<float, 16> getMatrix(CoordinateType coordinateType) const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
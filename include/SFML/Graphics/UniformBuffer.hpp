@@ -0,0 +1,280 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Block of uniform data in graphics memory, shared by several shaders
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API UniformBuffer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// \see `sf::VertexBuffer::Usage`
+    ///
+    ////////////////////////////////////////////////////////////
+    using Usage = VertexBuffer::Usage;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty uniform buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a `UniformBuffer` with a specific usage specifier
+    ///
+    /// Creates an empty uniform buffer and sets its usage to \p usage.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit UniformBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(const UniformBuffer& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UniformBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the uniform buffer
+    ///
+    /// Creates the uniform buffer and allocates `size` bytes
+    /// of graphics memory. Any previously allocated memory is
+    /// freed in the process.
+    ///
+    /// The size should match the size of the uniform block
+    /// the buffer is bound to, with the block members laid
+    /// out following the `std140` rules.
+    ///
+    /// \param size Size of the buffer in bytes
+    ///
+    /// \return `true` if creation was successful, `false` if
+    ///         uniform buffers are not available
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the buffer
+    ///
+    /// \return Size of the uniform buffer in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole buffer from a block of memory
+    ///
+    /// The memory block is assumed to have the same size as
+    /// the created buffer.
+    ///
+    /// \param data Pointer to the data to copy to the buffer
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from a block of memory
+    ///
+    /// `offset` is specified as the number of bytes to skip
+    /// from the beginning of the buffer. The same resizing rules
+    /// as `sf::VertexBuffer::update` apply.
+    ///
+    /// \param data   Pointer to the data to copy to the buffer
+    /// \param size   Number of bytes to copy
+    /// \param offset Offset in the buffer to copy to, in bytes
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data, std::size_t size, std::size_t offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy the contents of another buffer into this buffer
+    ///
+    /// This buffer is resized to the size of the other one.
+    ///
+    /// \param uniformBuffer Uniform buffer whose contents to copy into this uniform buffer
+    ///
+    /// \return `true` if the copy was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const UniformBuffer& uniformBuffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(const UniformBuffer& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the contents of this uniform buffer with those of another
+    ///
+    /// \param right Instance to swap with
+    ///
+    ////////////////////////////////////////////////////////////
+    void swap(UniformBuffer& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the uniform buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the uniform buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this uniform buffer
+    ///
+    /// After changing the usage specifier, the uniform buffer has
+    /// to be updated with new data for the usage specifier to
+    /// take effect.
+    ///
+    /// The default usage type is `sf::VertexBuffer::Usage::Stream`.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this uniform buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports uniform buffers
+    ///
+    /// Uniform buffers require OpenGL 3.1 and shader support.
+    /// If this function returns `false`, uniform buffers can't
+    /// be created and shaders can't use uniform blocks.
+    ///
+    /// \return `true` if uniform buffers are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_buffer{};             //!< Internal buffer identifier
+    std::size_t  m_size{};               //!< Size in bytes of the currently allocated buffer
+    Usage        m_usage{Usage::Stream}; //!< How this uniform buffer is to be used
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Swap the contents of one uniform buffer with those of another
+///
+/// \param left First instance to swap
+/// \param right Second instance to swap
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void swap(UniformBuffer& left, UniformBuffer& right) noexcept;
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UniformBuffer
+/// \ingroup graphics
+///
+/// `sf::UniformBuffer` stores a block of uniform values in
+/// graphics memory. Contrary to uniforms set with
+/// `sf::Shader::setUniform`, which belong to a single shader,
+/// a uniform buffer can be referenced by any number of shaders
+/// through a uniform block of the same layout. Data shared by
+/// many shaders, such as camera or lighting parameters, is then
+/// uploaded once per frame instead of once per shader.
+///
+/// The contents of the buffer are raw bytes: the application
+/// is responsible for laying them out like the GLSL block,
+/// following the `std140` layout rules.
+///
+/// Example:
+/// \code
+/// // GLSL: layout(std140) uniform Frame { mat4 viewProjection; vec4 time; };
+/// struct Frame
+/// {
+///     float viewProjection[16];
+///     float time[4];
+/// };
+///
+/// sf::UniformBuffer frameBuffer;
+/// if (!frameBuffer.create(sizeof(Frame)))
+///     // uniform buffers are not available...
+///
+/// sceneShader.setUniformBlock("Frame", frameBuffer);
+/// postShader.setUniformBlock("Frame", frameBuffer);
+/// ...
+/// Frame frame = ...;
+/// frameBuffer.update(&frame); // both shaders see the new values
+/// \endcode
+///
+/// \see `sf::Shader::setUniformBlock`
+///
+////////////////////////////////////////////////////////////
@@ -35,6 +35,8 @@
 
 #include <SFML/Window/GlResource.hpp>
 
+#include <memory>
+
 #include <cstddef>
 
 
@@ -43,6 +45,11 @@ namespace sf
 class RenderTarget;
 struct Vertex;
 
+namespace priv
+{
+struct VertexBufferRing;
+}
+
 ////////////////////////////////////////////////////////////
 /// \brief Vertex buffer storage for one or more 2D primitives
 ///
@@ -59,12 +66,17 @@ public:
     /// usage to Static. For everything else Dynamic should be a
     /// good compromise.
     ///
+    /// If data is entirely rewritten once or more every frame,
+    /// Streaming avoids stalling on the previous contents of the
+    /// buffer while the GPU is still drawing them, see `map`.
+    ///
     ////////////////////////////////////////////////////////////
     enum class Usage
     {
-        Stream,  //!< Constantly changing data
-        Dynamic, //!< Occasionally changing data
-        Static   //!< Rarely changing data
+        Stream,   //!< Constantly changing data
+        Dynamic,  //!< Occasionally changing data
+        Static,   //!< Rarely changing data
+        Streaming //!< Data entirely rewritten every time it is used, written through `map`
     };
 
     ////////////////////////////////////////////////////////////
@@ -73,7 +85,7 @@ public:
     /// Creates an empty vertex buffer.
     ///
     ////////////////////////////////////////////////////////////
-    VertexBuffer() = default;
+    VertexBuffer();
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct a `VertexBuffer` with a specific `PrimitiveType`
@@ -132,6 +144,12 @@ public:
     /// as `vertexCount`. Don't forget to recreate with a non-zero
     /// value when graphics memory should be allocated again.
     ///
+    /// With the `Usage::Streaming` usage, `vertexCount` is the
+    /// largest number of vertices that can be written at once.
+    /// A ring of several times this size is allocated so that new
+    /// vertices can be written while the GPU still reads the
+    /// previous ones.
+    ///
     /// \param vertexCount Number of vertices worth of memory to allocate
     ///
     /// \return `true` if creation was successful
@@ -142,11 +160,35 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Return the vertex count
     ///
+    /// This is the number of vertices that drawing the buffer
+    /// uses. With the `Usage::Streaming` usage, the buffer only
+    /// holds the region written by the last `map`/`unmap` pair
+    /// (or `update`), so this is the size of that region rather
+    /// than the size passed to `create`, which it only equals
+    /// until the first region is written.
+    ///
     /// \return Number of vertices in the vertex buffer
     ///
+    /// \see `getCapacity`
+    ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::size_t getVertexCount() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the number of vertices the buffer can hold
+    ///
+    /// This is the size passed to `create`, or grown by `update`.
+    /// With the `Usage::Streaming` usage, it is the largest number
+    /// of vertices that can be written at once, regardless of
+    /// the size of the last written region.
+    ///
+    /// \return Number of vertices worth of allocated memory
+    ///
+    /// \see `getVertexCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCapacity() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the whole buffer from an array of vertices
     ///
@@ -187,6 +229,10 @@ public:
     /// If `offset` is not 0 and `offset` + `vertexCount` is greater
     /// than the size of the currently created buffer, the update fails.
     ///
+    /// With the `Usage::Streaming` usage, the vertices are written
+    /// to a new region of the ring as if by `map`, `offset` must
+    /// be 0 and `vertexCount` can't exceed the created size.
+    ///
     /// No additional check is performed on the size of the vertex
     /// array. Passing invalid arguments will lead to undefined
     /// behavior.
@@ -210,6 +256,39 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(const VertexBuffer& vertexBuffer);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve room for new vertices and return a pointer to write them to
+    ///
+    /// This function is only available with the `Usage::Streaming`
+    /// usage. It reserves a new region of `vertexCount` vertices
+    /// in the ring, which the GPU is not reading from anymore, and
+    /// returns a pointer to write the vertices to in place. The
+    /// region becomes the contents of the vertex buffer once
+    /// `unmap` is called.
+    ///
+    /// The pointer is only valid until `unmap` is called, and the
+    /// vertex buffer can't be drawn in the meantime. The vertices
+    /// of a region should be drawn before the next region is mapped.
+    ///
+    /// \param vertexCount Number of vertices to write, at most the created size
+    ///
+    /// \return Pointer to the vertices to write, or null if mapping failed
+    ///
+    /// \see `unmap`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vertex* map(std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Finish writing the vertices of the region returned by `map`
+    ///
+    /// \return `true` if the vertices were written successfully
+    ///
+    /// \see `map`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool unmap();
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
@@ -269,7 +348,8 @@ public:
     ///
     /// After changing the usage specifier, the vertex buffer has
     /// to be updated with new data for the usage specifier to
-    /// take effect.
+    /// take effect. Switching to or from `Usage::Streaming`
+    /// requires creating the buffer again.
     ///
     /// The default usage type is `sf::VertexBuffer::Usage::Stream`.
     ///
@@ -322,6 +402,8 @@ public:
     [[nodiscard]] static bool isAvailable();
 
 private:
+    friend class RenderTarget;
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the vertex buffer to a render target
     ///
@@ -336,8 +418,11 @@ private:
     ////////////////////////////////////////////////////////////
     unsigned int  m_buffer{};                             //!< Internal buffer identifier
     std::size_t   m_size{};                               //!< Size in Vertices of the currently allocated buffer
+    std::size_t   m_firstVertex{};                        //!< Position of the first vertex to draw in the buffer
     PrimitiveType m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
     Usage         m_usage{Usage::Stream};                 //!< How this vertex buffer is to be used
+
+    std::unique_ptr<priv::VertexBufferRing> m_ring; //!< Ring of regions written through `map`, for `Usage::Streaming`
 };
 
 ////////////////////////////////////////////////////////////
@@ -395,6 +480,16 @@ SFML_GRAPHICS_API void swap(VertexBuffer& left, VertexBuffer& right) noexcept;
 /// pending data transfers complete before the vertex buffer is sourced
 /// by the rendering pipeline.
 ///
+/// Geometry that is entirely rewritten every frame is best stored
+/// in a vertex buffer with the `Usage::Streaming` usage. Such a
+/// buffer manages a ring of regions: each call to `map` hands out
+/// a region that the GPU is not reading from anymore, so that the
+/// vertices can be written in place without waiting for previous
+/// draws to complete nor going through an intermediate array.
+/// Depending on what the system supports, the ring is persistently
+/// mapped and guarded by fences, or orphaned every time it wraps
+/// around.
+///
 /// It inherits `sf::Drawable`, but unlike other drawables it
 /// is not transformable.
 ///
@@ -409,6 +504,23 @@ SFML_GRAPHICS_API void swap(VertexBuffer& left, VertexBuffer& right) noexcept;
 /// window.draw(triangles);
 /// \endcode
 ///
+/// Streaming example:
+/// \code
+/// sf::VertexBuffer particles(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Streaming);
+/// particles.create(maxParticleCount * 6);
+///
+/// while (window.isOpen())
+/// {
+///     ...
+///     sf::Vertex* vertices = particles.map(particleCount * 6);
+///     ... // write the vertices of each particle
+///     particles.unmap();
+///
+///     window.draw(particles);
+///     ...
+/// }
+/// \endcode
+///
 /// \see `sf::Vertex`, `sf::VertexArray`
 ///
 ////////////////////////////////////////////////////////////
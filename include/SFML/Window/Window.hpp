@@ -338,6 +338,17 @@ public:
     ////////////////////////////////////////////////////////////
     void display();
 
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the window is displayed
+    ///
+    /// This function is called so that derived classes can
+    /// finish their rendering of the current frame before
+    /// it is shown on screen.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onDisplay();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Perform some common internal initializations
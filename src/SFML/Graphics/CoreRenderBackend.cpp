@@ -0,0 +1,584 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CoreRenderBackend.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <utility>
+
+#include <cstring>
+
+
+#ifndef SFML_OPENGL_ES
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace CoreRenderBackendImpl
+{
+// Number of vertices the stream buffer can hold before it has to be orphaned
+constexpr std::size_t streamBufferCapacity = 65536;
+
+// clang-format off
+constexpr std::array<float, 16> identityMatrix = {1.f, 0.f, 0.f, 0.f,
+                                                  0.f, 1.f, 0.f, 0.f,
+                                                  0.f, 0.f, 1.f, 0.f,
+                                                  0.f, 0.f, 0.f, 1.f};
+// clang-format on
+
+// Vertex shader of the built-in program
+constexpr const char* vertexShader = R"(
+#version 150
+
+in vec2 sf_position;
+in vec4 sf_color;
+in vec2 sf_texCoords;
+
+uniform mat4 sf_projectionMatrix;
+uniform mat4 sf_modelMatrix;
+uniform mat4 sf_textureMatrix;
+
+out vec4 sf_fragColor;
+out vec2 sf_fragTexCoords;
+
+void main()
+{
+    gl_Position = sf_projectionMatrix * sf_modelMatrix * vec4(sf_position, 0.0, 1.0);
+    sf_fragTexCoords = (sf_textureMatrix * vec4(sf_texCoords, 0.0, 1.0)).xy;
+    sf_fragColor = sf_color;
+}
+)";
+
+// Fragment shader of the built-in program
+constexpr const char* fragmentShader = R"(
+#version 150
+
+uniform sampler2D sf_texture;
+uniform float sf_textured;
+
+in vec4 sf_fragColor;
+in vec2 sf_fragTexCoords;
+
+out vec4 sf_outColor;
+
+void main()
+{
+    vec4 texel = texture(sf_texture, sf_fragTexCoords);
+    sf_outColor = sf_fragColor * mix(vec4(1.0), texel, sf_textured);
+}
+)";
+
+// Compile a stage of the built-in program, returns 0 on failure
+GLuint compileShader(GLenum type, const char* source)
+{
+    const GLuint shader = glCheck(glCreateShader(type));
+    glCheck(glShaderSource(shader, 1, &source, nullptr));
+    glCheck(glCompileShader(shader));
+
+    GLint success = GL_FALSE;
+    glCheck(glGetShaderiv(shader, GL_COMPILE_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        std::array<char, 1024> log{};
+        glCheck(glGetShaderInfoLog(shader, static_cast<GLsizei>(log.size()), nullptr, log.data()));
+        sf::err() << "Failed to compile the built-in "
+                  << (type == GL_VERTEX_SHADER ? "vertex" : "fragment") << " shader:" << '\n'
+                  << log.data() << std::endl;
+        glCheck(glDeleteShader(shader));
+        return 0;
+    }
+
+    return shader;
+}
+} // namespace CoreRenderBackendImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+struct CoreRenderBackend::VertexArrayObject
+{
+    VertexArrayObject()
+    {
+        // Create the vertex array object
+        glCheck(GLEXT_glGenVertexArrays(1, &object));
+    }
+
+    ~VertexArrayObject()
+    {
+        if (object)
+            glCheck(GLEXT_glDeleteVertexArrays(1, &object));
+    }
+
+    GLuint object{};
+};
+
+
+////////////////////////////////////////////////////////////
+CoreRenderBackend::CoreRenderBackend() :
+m_projectionMatrix(CoreRenderBackendImpl::identityMatrix),
+m_modelMatrix(CoreRenderBackendImpl::identityMatrix),
+m_textureMatrix(CoreRenderBackendImpl::identityMatrix)
+{
+    const TransientContextLock lock;
+
+    if (!isAvailable() || !loadProgram())
+        return;
+
+    m_programLocations = getLocations(m_program);
+
+    // Create the buffer the vertices drawn from client memory are streamed through
+    m_streamCapacity = CoreRenderBackendImpl::streamBufferCapacity;
+
+    glCheck(GLEXT_glGenBuffers(1, &m_streamBuffer));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_streamBuffer));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * m_streamCapacity),
+                               nullptr,
+                               GLEXT_GL_STREAM_DRAW));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+}
+
+
+////////////////////////////////////////////////////////////
+CoreRenderBackend::~CoreRenderBackend()
+{
+    const TransientContextLock lock;
+
+    // Unregister VAOs with the contexts if they haven't already been destroyed
+    for (auto& entry : m_vertexArrays)
+    {
+        auto vertexArray = entry.second.lock();
+
+        if (vertexArray)
+            unregisterUnsharedGlObject(std::move(vertexArray));
+    }
+
+    if (m_streamBuffer)
+        glCheck(GLEXT_glDeleteBuffers(1, &m_streamBuffer));
+
+    if (m_program)
+        glCheck(glDeleteProgram(m_program));
+}
+
+
+////////////////////////////////////////////////////////////
+bool CoreRenderBackend::isAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        ensureExtensionsInit();
+
+        return GLEXT_core_profile && GLEXT_vertex_array_object;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CoreRenderBackend::isCoreProfile()
+{
+    if (!isAvailable())
+        return false;
+
+    GLint profileMask = 0;
+    glCheck(glGetIntegerv(GLEXT_GL_CONTEXT_PROFILE_MASK, &profileMask));
+
+    return (profileMask & GLEXT_GL_CONTEXT_CORE_PROFILE_BIT) != 0;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CoreRenderBackend::isLoaded() const
+{
+    return m_program != 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::activate()
+{
+    std::weak_ptr<VertexArrayObject>&  entry       = m_vertexArrays[Context::getActiveContextId()];
+    std::shared_ptr<VertexArrayObject> vertexArray = entry.lock();
+
+    if (!vertexArray)
+    {
+        vertexArray = std::make_shared<VertexArrayObject>();
+        entry       = vertexArray;
+
+        // Register the object with the current context so it is automatically destroyed
+        registerUnsharedGlObject(vertexArray);
+    }
+
+    glCheck(GLEXT_glBindVertexArray(vertexArray->object));
+
+    // Install the built-in program, even if it was current before the backend was deactivated
+    m_currentProgram = 0;
+    setProgram(0);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::deactivate()
+{
+    glCheck(GLEXT_glBindVertexArray(0));
+    glCheck(glUseProgram(0));
+
+    m_currentProgram = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::setProjectionMatrix(const float* matrix)
+{
+    if (std::equal(m_projectionMatrix.begin(), m_projectionMatrix.end(), matrix))
+        return;
+
+    std::copy(matrix, matrix + 16, m_projectionMatrix.begin());
+    m_projectionMatrixChanged = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::setModelMatrix(const float* matrix)
+{
+    if (std::equal(m_modelMatrix.begin(), m_modelMatrix.end(), matrix))
+        return;
+
+    std::copy(matrix, matrix + 16, m_modelMatrix.begin());
+    m_modelMatrixChanged = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::setTexture(bool textured, const float* matrix)
+{
+    if ((textured == m_textured) && std::equal(m_textureMatrix.begin(), m_textureMatrix.end(), matrix))
+        return;
+
+    m_textured = textured;
+    std::copy(matrix, matrix + 16, m_textureMatrix.begin());
+    m_textureChanged = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::setProgram(unsigned int program)
+{
+    const unsigned int newProgram = program ? program : m_program;
+    if (newProgram == m_currentProgram)
+        return;
+
+    // User programs are installed by sf::Shader::bind, along with their own textures
+    if (!program)
+        glCheck(glUseProgram(m_program));
+
+    m_currentProgram = newProgram;
+    m_locations      = program ? getLocations(program) : m_programLocations;
+
+    // Uniforms belong to the program, a different program needs all of them
+    m_projectionMatrixChanged = true;
+    m_modelMatrixChanged      = true;
+    m_textureChanged          = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::bindVertices(const Vertex* vertices, std::size_t vertexCount)
+{
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_streamBuffer));
+
+    // Orphan the buffer when it is full, the driver hands us fresh storage while
+    // the previous one is still read by the pending draws; grow it if it is too small
+    if (m_streamHead + vertexCount > m_streamCapacity)
+    {
+        m_streamCapacity = std::max(m_streamCapacity, vertexCount);
+        m_streamHead     = 0;
+
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * m_streamCapacity),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_DRAW));
+    }
+
+    const std::size_t offset = sizeof(Vertex) * m_streamHead;
+    const std::size_t size   = sizeof(Vertex) * vertexCount;
+
+    // The range was never written since the last orphaning, so no pending draw reads it
+    const GLbitfield access = GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT |
+                              GLEXT_GL_MAP_UNSYNCHRONIZED_BIT;
+
+    void* const data = glCheck(GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER,
+                                                      static_cast<GLintptr>(offset),
+                                                      static_cast<GLsizeiptr>(size),
+                                                      access));
+
+    if (data)
+    {
+        std::memcpy(data, vertices, size);
+        glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
+    }
+    else
+    {
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      static_cast<GLintptrARB>(offset),
+                                      static_cast<GLsizeiptrARB>(size),
+                                      vertices));
+    }
+
+    setupAttributes(offset);
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    m_streamHead += vertexCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::bindVertexBuffer(std::size_t offset)
+{
+    setupAttributes(offset);
+}
+
+
+////////////////////////////////////////////////////////////
+bool CoreRenderBackend::loadProgram()
+{
+    using CoreRenderBackendImpl::compileShader;
+
+    const GLuint vertexShader   = compileShader(GL_VERTEX_SHADER, CoreRenderBackendImpl::vertexShader);
+    const GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, CoreRenderBackendImpl::fragmentShader);
+
+    if (!vertexShader || !fragmentShader)
+    {
+        if (vertexShader)
+            glCheck(glDeleteShader(vertexShader));
+        if (fragmentShader)
+            glCheck(glDeleteShader(fragmentShader));
+
+        return false;
+    }
+
+    const GLuint program = glCheck(glCreateProgram());
+    glCheck(glAttachShader(program, vertexShader));
+    glCheck(glAttachShader(program, fragmentShader));
+
+    // Fix the attribute locations, so that they never change in the vertex array object
+    glCheck(glBindAttribLocation(program, 0, "sf_position"));
+    glCheck(glBindAttribLocation(program, 1, "sf_color"));
+    glCheck(glBindAttribLocation(program, 2, "sf_texCoords"));
+
+    glCheck(glLinkProgram(program));
+
+    // The shaders are released along with the program
+    glCheck(glDeleteShader(vertexShader));
+    glCheck(glDeleteShader(fragmentShader));
+
+    GLint success = GL_FALSE;
+    glCheck(glGetProgramiv(program, GL_LINK_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        std::array<char, 1024> log{};
+        glCheck(glGetProgramInfoLog(program, static_cast<GLsizei>(log.size()), nullptr, log.data()));
+        err() << "Failed to link the built-in shader:" << '\n' << log.data() << std::endl;
+        glCheck(glDeleteProgram(program));
+        return false;
+    }
+
+    m_program = program;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+CoreRenderBackend::Locations CoreRenderBackend::getLocations(unsigned int program)
+{
+    const auto attribute = [program](const char* name) { return glCheck(glGetAttribLocation(program, name)); };
+    const auto uniform   = [program](const char* name) { return glCheck(glGetUniformLocation(program, name)); };
+
+    Locations locations;
+    locations.position         = attribute("sf_position");
+    locations.color            = attribute("sf_color");
+    locations.texCoords        = attribute("sf_texCoords");
+    locations.projectionMatrix = uniform("sf_projectionMatrix");
+    locations.modelMatrix      = uniform("sf_modelMatrix");
+    locations.textureMatrix    = uniform("sf_textureMatrix");
+    locations.texture          = uniform("sf_texture");
+    locations.textured         = uniform("sf_textured");
+
+    return locations;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::setupAttributes(std::size_t offset)
+{
+    const auto setAttribute = [offset](int location, GLint size, GLenum type, std::size_t componentOffset)
+    {
+        // Attributes that the program doesn't use have no location
+        if (location < 0)
+            return;
+
+        const auto      index      = static_cast<GLuint>(location);
+        const GLboolean normalized = (type == GL_UNSIGNED_BYTE) ? GL_TRUE : GL_FALSE;
+
+        glCheck(GLEXT_glEnableVertexAttribArray(index));
+        glCheck(GLEXT_glVertexAttribPointer(index,
+                                            size,
+                                            type,
+                                            normalized,
+                                            sizeof(Vertex),
+                                            reinterpret_cast<const void*>(offset + componentOffset)));
+    };
+
+    setAttribute(m_locations.position, 2, GL_FLOAT, 0);
+    setAttribute(m_locations.color, 4, GL_UNSIGNED_BYTE, 8);
+    setAttribute(m_locations.texCoords, 2, GL_FLOAT, 12);
+
+    // Upload the uniforms that changed since the last draw
+    if (m_projectionMatrixChanged && (m_locations.projectionMatrix >= 0))
+        glCheck(glUniformMatrix4fv(m_locations.projectionMatrix, 1, GL_FALSE, m_projectionMatrix.data()));
+
+    if (m_modelMatrixChanged && (m_locations.modelMatrix >= 0))
+        glCheck(glUniformMatrix4fv(m_locations.modelMatrix, 1, GL_FALSE, m_modelMatrix.data()));
+
+    if (m_textureChanged)
+    {
+        if (m_locations.textureMatrix >= 0)
+            glCheck(glUniformMatrix4fv(m_locations.textureMatrix, 1, GL_FALSE, m_textureMatrix.data()));
+        if (m_locations.texture >= 0)
+            glCheck(glUniform1i(m_locations.texture, 0));
+        if (m_locations.textured >= 0)
+            glCheck(glUniform1f(m_locations.textured, m_textured ? 1.f : 0.f));
+    }
+
+    m_projectionMatrixChanged = false;
+    m_modelMatrixChanged      = false;
+    m_textureChanged          = false;
+}
+
+} // namespace sf::priv
+
+#else // SFML_OPENGL_ES
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+CoreRenderBackend::CoreRenderBackend() = default;
+
+
+////////////////////////////////////////////////////////////
+CoreRenderBackend::~CoreRenderBackend() = default;
+
+
+////////////////////////////////////////////////////////////
+bool CoreRenderBackend::isAvailable()
+{
+    // Core profile contexts don't exist in OpenGL ES
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CoreRenderBackend::isCoreProfile()
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CoreRenderBackend::isLoaded() const
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::activate()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::deactivate()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::setProjectionMatrix(const float* /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::setModelMatrix(const float* /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::setTexture(bool /* textured */, const float* /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::setProgram(unsigned int /* program */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::bindVertices(const Vertex* /* vertices */, std::size_t /* vertexCount */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreRenderBackend::bindVertexBuffer(std::size_t /* offset */)
+{
+}
+
+} // namespace sf::priv
+
+#endif // SFML_OPENGL_ES
@@ -0,0 +1,251 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/GlResource.hpp>
+
+#include <array>
+#include <memory>
+#include <unordered_map>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+struct Vertex;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Programmable pipeline used by render targets
+///        on core profile contexts
+///
+////////////////////////////////////////////////////////////
+class CoreRenderBackend : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Compiles the built-in program and creates the stream
+    /// buffer. An OpenGL context must be active.
+    ///
+    ////////////////////////////////////////////////////////////
+    CoreRenderBackend();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~CoreRenderBackend();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    CoreRenderBackend(const CoreRenderBackend&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    CoreRenderBackend& operator=(const CoreRenderBackend&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the system supports the core profile backend
+    ///
+    /// \return `true` if OpenGL 3.2 or later is available
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the active context uses the core profile
+    ///
+    /// \return `true` if the fixed-function pipeline is unavailable in the active context
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isCoreProfile();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the built-in program was compiled successfully
+    ///
+    /// \return `true` if the backend can be used for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isLoaded() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the vertex array object and the built-in program
+    ///
+    /// The vertex array object is recreated if the active
+    /// context is not the one it was created in, since vertex
+    /// array objects can't be shared between contexts.
+    ///
+    ////////////////////////////////////////////////////////////
+    void activate();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unbind the vertex array object and the program
+    ///
+    ////////////////////////////////////////////////////////////
+    void deactivate();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the view-projection matrix
+    ///
+    /// \param matrix 4x4 matrix, in column-major order
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProjectionMatrix(const float* matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the model matrix
+    ///
+    /// \param matrix 4x4 matrix, in column-major order
+    ///
+    ////////////////////////////////////////////////////////////
+    void setModelMatrix(const float* matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the texturing state
+    ///
+    /// The texture itself must be bound to texture unit 0.
+    ///
+    /// \param textured Is a texture bound?
+    /// \param matrix   4x4 texture coordinates matrix, in column-major order
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(bool textured, const float* matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the program used for drawing
+    ///
+    /// A user program gets the same attributes and uniforms
+    /// as the built-in one, as long as it uses the same names.
+    ///
+    /// \param program Program to use, or 0 to use the built-in program
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProgram(unsigned int program);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload vertices to the stream buffer and point the attributes to them
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindVertices(const Vertex* vertices, std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Point the attributes to the bound vertex buffer
+    ///
+    /// \param offset Offset of the first vertex in the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindVertexBuffer(std::size_t offset);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Vertex array object owned by a single context
+    ///
+    ////////////////////////////////////////////////////////////
+    struct VertexArrayObject;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Locations of the attributes and uniforms of a program
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Locations
+    {
+        int position{-1};         //!< Location of the vertex position attribute
+        int color{-1};            //!< Location of the vertex color attribute
+        int texCoords{-1};        //!< Location of the vertex texture coordinates attribute
+        int projectionMatrix{-1}; //!< Location of the view-projection matrix uniform
+        int modelMatrix{-1};      //!< Location of the model matrix uniform
+        int textureMatrix{-1};    //!< Location of the texture matrix uniform
+        int texture{-1};          //!< Location of the texture sampler uniform
+        int textured{-1};         //!< Location of the texturing switch uniform
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compile and link the built-in program
+    ///
+    /// \return `true` on success
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadProgram();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Look up the attributes and uniforms of a program
+    ///
+    /// \param program Program to query
+    ///
+    /// \return Locations of the attributes and uniforms, -1 for the ones the program doesn't use
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Locations getLocations(unsigned int program);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Point the attributes to the bound array buffer and upload the modified uniforms
+    ///
+    /// \param offset Offset of the first vertex in the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void setupAttributes(std::size_t offset);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    // Vertex array objects are not shared between contexts
+    using VertexArrayMap = std::unordered_map<std::uint64_t, std::weak_ptr<VertexArrayObject>>;
+
+    unsigned int          m_program{};                 //!< Built-in program
+    Locations             m_programLocations;          //!< Locations in the built-in program
+    unsigned int          m_currentProgram{};          //!< Program currently used for drawing
+    Locations             m_locations;                 //!< Locations in the current program
+    VertexArrayMap        m_vertexArrays;              //!< Vertex array objects per context
+    unsigned int          m_streamBuffer{};            //!< Buffer receiving the client vertices
+    std::size_t           m_streamCapacity{};          //!< Capacity of the stream buffer, in vertices
+    std::size_t           m_streamHead{};              //!< Next write position in the stream buffer
+    std::array<float, 16> m_projectionMatrix{};        //!< Current view-projection matrix
+    std::array<float, 16> m_modelMatrix{};             //!< Current model matrix
+    std::array<float, 16> m_textureMatrix{};           //!< Current texture matrix
+    bool                  m_textured{};                //!< Is a texture bound?
+    bool                  m_projectionMatrixChanged{}; //!< Must the view-projection matrix be uploaded?
+    bool                  m_modelMatrixChanged{};      //!< Must the model matrix be uploaded?
+    bool                  m_textureChanged{};          //!< Must the texturing state be uploaded?
+};
+
+} // namespace priv
+
+} // namespace sf
@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/ResourceStream.hpp>
@@ -44,10 +45,21 @@
 #include FT_BITMAP_H
 #include FT_STROKER_H
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <optional>
 #include <ostream>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 
 #include <cmath>
+#include <cstddef>
 #include <cstring>
 
 
@@ -85,6 +97,402 @@ std::uint64_t combine(float outlineThickness, bool bold, std::uint32_t index)
 {
     return (std::uint64_t{reinterpret<std::uint32_t>(outlineThickness)} << 32) | (std::uint64_t{bold} << 31) | index;
 }
+
+// Small padding left around characters, so that filtering doesn't pollute them with pixels from neighbors
+constexpr unsigned int glyphPadding = 2;
+
+// Maximum number of kerning values cached for a character size and boldness, the table starts over beyond it
+constexpr std::size_t maxCachedKernings = 1 << 16;
+
+// Character size at which distance field glyphs are rasterized
+constexpr unsigned int distanceFieldSize = 64;
+
+// Distance covered by distance fields on each side of the glyph edges, in pixels at the reference size
+constexpr unsigned int distanceFieldSpread = 8;
+
+// Fragment shader turning distance field glyphs into sharp glyphs at any scale
+constexpr const char* distanceFieldFragmentShader = R"(
+#version 110
+
+uniform sampler2D sf_texture;
+uniform float sf_threshold;
+
+void main()
+{
+    // The alpha channel holds the distance to the edge of the glyph, which lies at 0.5
+    float distance = texture2D(sf_texture, gl_TexCoord[0].xy).a;
+    float smoothing = max(0.7 * fwidth(distance), 0.0001);
+    float alpha = smoothstep(sf_threshold - smoothing, sf_threshold + smoothing, distance);
+    gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);
+}
+)";
+
+// Glyph rasterized by FreeType, before it is packed into a page
+struct GlyphBitmap
+{
+    sf::Glyph    glyph;           // Metrics of the glyph, its texture rectangle is not known yet
+    sf::Vector2u size;            // Size of the pixels, padding included (zero if the glyph is empty)
+    bool         outlineFailed{}; // Was an outline requested for a glyph that can't be outlined?
+};
+
+// Rasterize a glyph and expand it to RGBA pixels, the face must already be set to the requested character size
+// This function doesn't touch any shared state, so it can run concurrently on distinct FreeType libraries
+std::optional<GlyphBitmap> rasterizeGlyph(FT_Library                 library,
+                                          FT_Face                    face,
+                                          FT_Stroker                 stroker,
+                                          char32_t                   codePoint,
+                                          bool                       bold,
+                                          float                      outlineThickness,
+                                          std::vector<std::uint8_t>& pixelBuffer)
+{
+    // Load the glyph corresponding to the code point
+    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
+    if (outlineThickness != 0)
+        flags |= FT_LOAD_NO_BITMAP;
+    if (FT_Load_Char(face, codePoint, flags) != 0)
+        return std::nullopt;
+
+    // Retrieve the glyph
+    FT_Glyph glyphDesc = nullptr;
+    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+        return std::nullopt;
+
+    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
+    const FT_Pos weight  = 1 << 6;
+    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
+    if (outline)
+    {
+        if (bold)
+        {
+            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
+            FT_Outline_Embolden(&outlineGlyph->outline, weight);
+        }
+
+        if (outlineThickness != 0)
+        {
+            FT_Stroker_Set(stroker,
+                           static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
+                           FT_STROKER_LINECAP_ROUND,
+                           FT_STROKER_LINEJOIN_ROUND,
+                           0);
+            FT_Glyph_Stroke(&glyphDesc, stroker, true);
+        }
+    }
+
+    // Convert the glyph to a bitmap (i.e. rasterize it)
+    // Warning! After this line, do not read any data from glyphDesc directly, use
+    // bitmapGlyph.root to access the FT_Glyph data.
+    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
+    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+
+    GlyphBitmap result;
+
+    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
+    if (!outline)
+    {
+        if (bold)
+            FT_Bitmap_Embolden(library, &bitmap, weight, weight);
+
+        result.outlineFailed = (outlineThickness != 0);
+    }
+
+    // Compute the glyph's advance offset
+    result.glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
+    if (bold)
+        result.glyph.advance += static_cast<float>(weight) / float{1 << 6};
+
+    result.glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
+    result.glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+
+    sf::Vector2u size(bitmap.width, bitmap.rows);
+
+    if ((size.x > 0) && (size.y > 0))
+    {
+        size += 2u * sf::Vector2u(glyphPadding, glyphPadding);
+        result.size = size;
+
+        // Compute the glyph's bounding box
+        result.glyph.bounds.position = sf::Vector2f(sf::Vector2i(bitmapGlyph->left, -bitmapGlyph->top));
+        result.glyph.bounds.size     = sf::Vector2f(sf::Vector2u(bitmap.width, bitmap.rows));
+
+        // Resize the pixel buffer to the new size and fill it with transparent white pixels
+        pixelBuffer.resize(std::size_t{size.x} * std::size_t{size.y} * 4);
+
+        std::uint8_t* current = pixelBuffer.data();
+        std::uint8_t* end     = current + size.x * size.y * 4;
+
+        while (current != end)
+        {
+            (*current++) = 255;
+            (*current++) = 255;
+            (*current++) = 255;
+            (*current++) = 0;
+        }
+
+        // Extract the glyph's pixels from the bitmap
+        const std::uint8_t* pixels = bitmap.buffer;
+        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        {
+            // Pixels are 1 bit monochrome values
+            for (unsigned int y = glyphPadding; y < size.y - glyphPadding; ++y)
+            {
+                for (unsigned int x = glyphPadding; x < size.x - glyphPadding; ++x)
+                {
+                    // The color channels remain white, just fill the alpha channel
+                    const std::size_t index = x + y * size.x;
+                    pixelBuffer[index * 4 + 3] = ((pixels[(x - glyphPadding) / 8]) & (1 << (7 - ((x - glyphPadding) % 8))))
+                                                     ? 255
+                                                     : 0;
+                }
+                pixels += bitmap.pitch;
+            }
+        }
+        else
+        {
+            // Pixels are 8 bit gray levels
+            for (unsigned int y = glyphPadding; y < size.y - glyphPadding; ++y)
+            {
+                for (unsigned int x = glyphPadding; x < size.x - glyphPadding; ++x)
+                {
+                    // The color channels remain white, just fill the alpha channel
+                    const std::size_t index    = x + y * size.x;
+                    pixelBuffer[index * 4 + 3] = pixels[x - glyphPadding];
+                }
+                pixels += bitmap.pitch;
+            }
+        }
+    }
+
+    // Delete the FT glyph
+    FT_Done_Glyph(glyphDesc);
+
+    return result;
+}
+
+// Replace each sample by its squared distance to the nearest sample at zero
+// This is the linear time algorithm from "Distance Transforms of Sampled Functions" by Felzenszwalb and Huttenlocher,
+// applied to the columns and then to the rows of the grid
+void squaredDistanceTransform(std::vector<float>& grid, sf::Vector2u size)
+{
+    const std::size_t        length = std::max(size.x, size.y);
+    std::vector<float>       input(length);
+    std::vector<float>       output(length);
+    std::vector<float>       boundaries(length + 1);
+    std::vector<std::size_t> parabolas(length);
+
+    const auto transform = [&](std::size_t count)
+    {
+        const auto intersection = [&](std::size_t q, std::size_t p)
+        {
+            const auto fq = static_cast<float>(q);
+            const auto fp = static_cast<float>(p);
+            return ((input[q] + fq * fq) - (input[p] + fp * fp)) / (2 * fq - 2 * fp);
+        };
+
+        // Compute the lower envelope of the parabolas rooted at each sample
+        std::size_t k = 0;
+        parabolas[0]  = 0;
+        boundaries[0] = -std::numeric_limits<float>::infinity();
+        boundaries[1] = std::numeric_limits<float>::infinity();
+        for (std::size_t q = 1; q < count; ++q)
+        {
+            float s = intersection(q, parabolas[k]);
+            while (s <= boundaries[k])
+                s = intersection(q, parabolas[--k]);
+
+            ++k;
+            parabolas[k]      = q;
+            boundaries[k]     = s;
+            boundaries[k + 1] = std::numeric_limits<float>::infinity();
+        }
+
+        // Sample the lower envelope
+        k = 0;
+        for (std::size_t q = 0; q < count; ++q)
+        {
+            while (boundaries[k + 1] < static_cast<float>(q))
+                ++k;
+
+            const auto offset = static_cast<float>(q) - static_cast<float>(parabolas[k]);
+            output[q]         = offset * offset + input[parabolas[k]];
+        }
+    };
+
+    for (std::size_t x = 0; x < size.x; ++x)
+    {
+        for (std::size_t y = 0; y < size.y; ++y)
+            input[y] = grid[x + y * size.x];
+        transform(size.y);
+        for (std::size_t y = 0; y < size.y; ++y)
+            grid[x + y * size.x] = output[y];
+    }
+
+    for (std::size_t y = 0; y < size.y; ++y)
+    {
+        std::copy_n(grid.begin() + static_cast<std::ptrdiff_t>(y * size.x), size.x, input.begin());
+        transform(size.x);
+        std::copy_n(output.begin(), size.x, grid.begin() + static_cast<std::ptrdiff_t>(y * size.x));
+    }
+}
+
+// Convert the pixels of a rasterized glyph into a signed distance field, padded by the spread on each side
+// The distance is stored in the alpha channel, 0.5 being on the edge and higher values inside the glyph
+sf::Vector2u computeDistanceField(const std::uint8_t* glyphPixels, sf::Vector2u glyphSize, std::vector<std::uint8_t>& fieldPixels)
+{
+    const sf::Vector2u inkSize   = glyphSize - 2u * sf::Vector2u(glyphPadding, glyphPadding);
+    const sf::Vector2u fieldSize = inkSize + 2u * sf::Vector2u(distanceFieldSpread, distanceFieldSpread);
+    const std::size_t  count     = std::size_t{fieldSize.x} * fieldSize.y;
+
+    // Pixels covered by at least half are inside the glyph
+    constexpr float    far = 1e20f;
+    std::vector<float> outsideDistances(count, far); // Squared distances to the nearest pixel inside the glyph
+    std::vector<float> insideDistances(count, 0.f);  // Squared distances to the nearest pixel outside the glyph
+    for (unsigned int y = 0; y < inkSize.y; ++y)
+    {
+        for (unsigned int x = 0; x < inkSize.x; ++x)
+        {
+            const std::size_t glyphIndex = (x + glyphPadding) + std::size_t{y + glyphPadding} * glyphSize.x;
+            if (glyphPixels[glyphIndex * 4 + 3] >= 128)
+            {
+                const std::size_t fieldIndex = (x + distanceFieldSpread) + std::size_t{y + distanceFieldSpread} * fieldSize.x;
+                outsideDistances[fieldIndex] = 0.f;
+                insideDistances[fieldIndex]  = far;
+            }
+        }
+    }
+
+    squaredDistanceTransform(outsideDistances, fieldSize);
+    squaredDistanceTransform(insideDistances, fieldSize);
+
+    fieldPixels.resize(count * 4);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // The edge lies half a pixel away from the centers of the pixels on either side of it
+        const float distance = (outsideDistances[i] > 0.f) ? std::sqrt(outsideDistances[i]) - 0.5f
+                                                           : 0.5f - std::sqrt(insideDistances[i]);
+        const float value = std::clamp(0.5f - distance / (2.f * float{distanceFieldSpread}), 0.f, 1.f);
+
+        fieldPixels[i * 4 + 0] = 255;
+        fieldPixels[i * 4 + 1] = 255;
+        fieldPixels[i * 4 + 2] = 255;
+        fieldPixels[i * 4 + 3] = static_cast<std::uint8_t>(std::lround(value * 255.f));
+    }
+
+    return fieldSize;
+}
+
+// Get the number of texels that the texture rectangle of an outlined distance field glyph is enlarged by on each side
+int getDistanceFieldMargin(float scale, float outlineThickness)
+{
+    if ((outlineThickness == 0) || (scale <= 0))
+        return 0;
+
+    const float outline = std::min(std::abs(outlineThickness) / scale, float{distanceFieldSpread});
+    return static_cast<int>(std::ceil(outline));
+}
+
+// Get the amount of memory used by a page texture, in bytes
+std::size_t getTextureBytes(const sf::Texture& texture)
+{
+    return std::size_t{texture.getSize().x} * texture.getSize().y * 4;
+}
+
+// Build the pixels of a page texture from its alpha channel, glyphs are always white
+std::vector<std::uint8_t> getPagePixels(const std::uint8_t* alpha, std::size_t count)
+{
+    std::vector<std::uint8_t> pixels(count * 4, 255);
+    for (std::size_t i = 0; i < count; ++i)
+        pixels[i * 4 + 3] = alpha[i];
+
+    return pixels;
+}
+
+// Signature and version at the beginning of atlas files
+constexpr char          atlasSignature[8] = {'S', 'F', 'A', 'T', 'L', 'A', 'S', '\0'};
+constexpr std::uint32_t atlasVersion      = 1;
+
+// Append an unsigned integer to an atlas buffer, in little endian order
+void writeAtlasInteger(std::vector<std::uint8_t>& buffer, std::uint64_t value, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+        buffer.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+}
+
+void writeAtlasFloat(std::vector<std::uint8_t>& buffer, float value)
+{
+    writeAtlasInteger(buffer, reinterpret<std::uint32_t>(value), 4);
+}
+
+void writeAtlasString(std::vector<std::uint8_t>& buffer, const std::string& string)
+{
+    writeAtlasInteger(buffer, string.size(), 4);
+    buffer.insert(buffer.end(), string.begin(), string.end());
+}
+
+// Sequential reader of an atlas buffer, which fails instead of reading past its end
+struct AtlasReader
+{
+    std::uint64_t readInteger(std::size_t size)
+    {
+        const std::uint8_t* bytes = readBytes(size);
+        if (!bytes)
+            return 0;
+
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < size; ++i)
+            value |= std::uint64_t{bytes[i]} << (i * 8);
+        return value;
+    }
+
+    std::uint32_t readUint32()
+    {
+        return static_cast<std::uint32_t>(readInteger(4));
+    }
+
+    std::int32_t readInt32()
+    {
+        return static_cast<std::int32_t>(readUint32());
+    }
+
+    float readFloat()
+    {
+        return reinterpret<float>(readUint32());
+    }
+
+    std::string readString()
+    {
+        const std::size_t   size  = readUint32();
+        const std::uint8_t* bytes = readBytes(size);
+        return bytes ? std::string(reinterpret_cast<const char*>(bytes), size) : std::string();
+    }
+
+    const std::uint8_t* readBytes(std::size_t size)
+    {
+        if (failed || (buffer.size() - offset < size))
+        {
+            failed = true;
+            return nullptr;
+        }
+
+        offset += size;
+        return buffer.data() + offset - size;
+    }
+
+    // Read a number of elements, making sure that the buffer is large enough to contain them
+    std::size_t readCount(std::size_t elementSize)
+    {
+        const std::size_t count = readUint32();
+        if (count > (buffer.size() - offset) / elementSize)
+            failed = true;
+
+        return failed ? 0 : count;
+    }
+
+    const std::vector<std::uint8_t>& buffer;
+    std::size_t                      offset{};
+    bool                             failed{};
+};
 } // namespace
 
 
@@ -115,10 +523,68 @@ struct Font::FontHandles
     FontHandles& operator=(FontHandles&&) = delete;
     // clang-format on
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Open or close the faces used by the rasterization threads
+    ///
+    /// \param count Number of faces wanted in the pool
+    ///
+    /// \return Number of faces available in the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t resizeFacePool(std::size_t count)
+    {
+        if (facePool.size() >= count)
+        {
+            facePool.resize(count);
+
+            // The copy of the font data is only used by the faces of the pool
+            if (facePool.empty())
+                std::vector<std::uint8_t>().swap(fontData);
+
+            return count;
+        }
+
+        // FreeType streams can't be shared between threads, so the
+        // additional faces are opened over a copy of the font data
+        if (fontData.empty())
+        {
+            auto* stream = static_cast<InputStream*>(streamRec.descriptor.pointer);
+            fontData.resize(streamRec.size);
+            if (!stream->seek(0).has_value() || (stream->read(fontData.data(), fontData.size()) != fontData.size()))
+            {
+                err() << "Failed to read the font data for the rasterization threads" << std::endl;
+                fontData.clear();
+                return facePool.size();
+            }
+        }
+
+        while (facePool.size() < count)
+        {
+            auto handles = std::make_unique<FontHandles>();
+
+            if ((FT_Init_FreeType(&handles->library) != 0) ||
+                (FT_New_Memory_Face(handles->library, fontData.data(), static_cast<FT_Long>(fontData.size()), 0, &handles->face) !=
+                 0) ||
+                (FT_Stroker_New(handles->library, &handles->stroker) != 0) ||
+                (FT_Select_Charmap(handles->face, FT_ENCODING_UNICODE) != 0))
+            {
+                err() << "Failed to create the font face of a rasterization thread" << std::endl;
+                break;
+            }
+
+            facePool.push_back(std::move(handles));
+        }
+
+        return facePool.size();
+    }
+
     FT_Library   library{};   //< Pointer to the internal library interface
     FT_StreamRec streamRec{}; //< Stream rec object describing an input stream
     FT_Face      face{};      //< Pointer to the internal font face
     FT_Stroker   stroker{};   //< Pointer to the stroker
+
+    std::vector<FT_Byte>                      fontData; //< Copy of the font data shared by the faces of the pool
+    std::vector<std::unique_ptr<FontHandles>> facePool; //< Additional faces used by the rasterization threads
 };
 
 
@@ -234,31 +700,93 @@ const Font::Info& Font::getInfo() const
 ////////////////////////////////////////////////////////////
 const Glyph& Font::getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
 {
+    if (m_glyphMode == GlyphMode::SignedDistanceField)
+        return getDistanceFieldGlyph(codePoint, characterSize, bold, outlineThickness);
+
     // Get the page corresponding to the character size
     GlyphTable& glyphs = loadPage(characterSize).glyphs;
 
     // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
-    const std::uint64_t key = combine(outlineThickness,
-                                      bold,
-                                      FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint));
+    const std::uint64_t key = combine(outlineThickness, bold, getGlyphIndex(codePoint));
 
     // Search the glyph into the cache
     if (const auto it = glyphs.find(key); it != glyphs.end())
     {
         // Found: just return it
+        ++m_cacheStatistics.hits;
         return it->second;
     }
 
     // Not found: we have to load it
+    ++m_cacheStatistics.misses;
     const Glyph glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
     return glyphs.try_emplace(key, glyph).first->second;
 }
 
 
+////////////////////////////////////////////////////////////
+void Font::preloadGlyphs(std::u32string_view codePoints, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    Page& page = loadPage(characterSize);
+
+    beginStaging(page);
+
+    // Rasterize the missing glyphs on several threads first, then only the glyphs evicted since then remain below
+    const bool concurrent = (m_rasterizationThreads > 1) && (m_glyphMode == GlyphMode::Bitmap) && m_fontHandles &&
+                            m_fontHandles->face && setCurrentSize(characterSize);
+    if (concurrent)
+        loadGlyphsConcurrently(page, codePoints, characterSize, bold, outlineThickness);
+
+    for (const char32_t codePoint : codePoints)
+    {
+        // The lookups of the concurrent loading were already counted
+        const std::uint64_t key = combine(outlineThickness, bold, getGlyphIndex(codePoint));
+        if (!concurrent || (page.glyphs.find(key) == page.glyphs.end()))
+            (void)getGlyph(codePoint, characterSize, bold, outlineThickness);
+    }
+    endStaging(page);
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::preloadGlyphs(char32_t first, char32_t last, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    Page& page = loadPage(characterSize);
+
+    beginStaging(page);
+
+    const bool concurrent = (m_rasterizationThreads > 1) && (m_glyphMode == GlyphMode::Bitmap) && m_fontHandles &&
+                            m_fontHandles->face && setCurrentSize(characterSize) && (first <= last);
+    if (concurrent)
+    {
+        std::u32string codePoints;
+        codePoints.reserve(std::size_t{last} - std::size_t{first} + 1);
+        for (char32_t codePoint = first; codePoint != last; ++codePoint)
+            codePoints.push_back(codePoint);
+        codePoints.push_back(last);
+
+        loadGlyphsConcurrently(page, codePoints, characterSize, bold, outlineThickness);
+    }
+
+    for (char32_t codePoint = first; codePoint <= last; ++codePoint)
+    {
+        // The lookups of the concurrent loading were already counted
+        const std::uint64_t key = combine(outlineThickness, bold, getGlyphIndex(codePoint));
+        if (!concurrent || (page.glyphs.find(key) == page.glyphs.end()))
+            (void)getGlyph(codePoint, characterSize, bold, outlineThickness);
+
+        // Don't wrap around if the range ends with the last representable code point
+        if (codePoint == last)
+            break;
+    }
+    endStaging(page);
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Font::hasGlyph(char32_t codePoint) const
 {
-    return FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint) != 0;
+    return getGlyphIndex(codePoint) != 0;
 }
 
 
@@ -271,16 +799,33 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
 
     FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
 
-    if (face && setCurrentSize(characterSize))
+    if (!face)
+        return 0.f;
+
+    // Search the pair into the cache
+    const std::uint64_t tableKey = (std::uint64_t{characterSize} << 1) | std::uint64_t{bold};
+    const std::uint64_t key      = (std::uint64_t{first} << 32) | std::uint64_t{second};
+    if (const auto tableIt = m_kernings.find(tableKey); tableIt != m_kernings.end())
+    {
+        if (const auto it = tableIt->second.find(key); it != tableIt->second.end())
+            return it->second;
+    }
+
+    if (setCurrentSize(characterSize))
     {
         // Convert the characters to indices
-        const FT_UInt index1 = FT_Get_Char_Index(face, first);
-        const FT_UInt index2 = FT_Get_Char_Index(face, second);
+        const FT_UInt index1 = getGlyphIndex(first);
+        const FT_UInt index2 = getGlyphIndex(second);
 
         // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
         const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold).rsbDelta);
         const auto secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold).lsbDelta);
 
+        // Loading the glyphs may have evicted pages along with the cached kerning, so the table is only taken now
+        KerningTable& kernings = m_kernings[tableKey];
+        if (kernings.size() >= maxCachedKernings)
+            kernings.clear();
+
         // Get the kerning vector if present
         FT_Vector kerning{0, 0};
         if (FT_HAS_KERNING(face))
@@ -288,11 +833,12 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
 
         // X advance is already in pixels for bitmap fonts
         if (!FT_IS_SCALABLE(face))
-            return static_cast<float>(kerning.x);
+            return kernings[key] = static_cast<float>(kerning.x);
 
         // Combine kerning with compensation deltas and return the X advance
         // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
-        return std::floor((secondLsbDelta - firstRsbDelta + static_cast<float>(kerning.x) + 32) / float{1 << 6});
+        return kernings[key] = std::floor((secondLsbDelta - firstRsbDelta + static_cast<float>(kerning.x) + 32) /
+                                          float{1 << 6});
     }
 
     // Invalid font
@@ -378,17 +924,389 @@ bool Font::isSmooth() const
 
 
 ////////////////////////////////////////////////////////////
-void Font::cleanup()
+void Font::setPackingAlgorithm(PackingAlgorithm algorithm)
 {
-    // Drop ownership of shared FreeType pointers
-    m_fontHandles.reset();
+    m_packingAlgorithm = algorithm;
+}
 
-    // Reset members
-    m_pages.clear();
-    std::vector<std::uint8_t>().swap(m_pixelBuffer);
 
-    // Drop the file stream if we held one due to openFromFile or openFromMemory
-    m_stream.reset();
+////////////////////////////////////////////////////////////
+Font::PackingAlgorithm Font::getPackingAlgorithm() const
+{
+    return m_packingAlgorithm;
+}
+
+
+////////////////////////////////////////////////////////////
+Font::PageStatistics Font::getPageStatistics(unsigned int characterSize) const
+{
+    const Page& page = loadPage(characterSize);
+
+    PageStatistics statistics;
+    statistics.textureSize    = page.texture.getSize();
+    statistics.glyphCount     = page.packedGlyphs;
+    statistics.usedArea       = page.usedArea;
+    statistics.textureResizes = page.textureResizes;
+
+    const auto textureArea = std::uint64_t{statistics.textureSize.x} * statistics.textureSize.y;
+    if (textureArea > 0)
+        statistics.occupancy = static_cast<float>(static_cast<double>(page.usedArea) / static_cast<double>(textureArea));
+
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::setRasterizationThreads(unsigned int count)
+{
+    m_rasterizationThreads = std::max(count, 1u);
+
+    // Close the faces of the threads that are not used anymore, new ones are opened by the next preload
+    if (m_fontHandles && (m_fontHandles->facePool.size() >= m_rasterizationThreads))
+        m_fontHandles->resizeFacePool(m_rasterizationThreads - 1);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Font::getRasterizationThreads() const
+{
+    return m_rasterizationThreads;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::setGlyphMode(GlyphMode mode)
+{
+    // The kerning depends on the hinting deltas of the glyphs
+    if (m_glyphMode != mode)
+        m_kernings.clear();
+
+    m_glyphMode = mode;
+}
+
+
+////////////////////////////////////////////////////////////
+Font::GlyphMode Font::getGlyphMode() const
+{
+    return m_glyphMode;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::setMemoryBudget(std::size_t bytes)
+{
+    m_memoryBudget = bytes;
+
+    if (m_memoryBudget != 0)
+        evictPages(nullptr, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Font::getMemoryBudget() const
+{
+    return m_memoryBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+Font::CacheStatistics Font::getCacheStatistics() const
+{
+    return m_cacheStatistics;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::saveAtlasToFile(const std::filesystem::path& filename) const
+{
+    if (!m_fontHandles || !m_fontHandles->face)
+    {
+        err() << "Failed to save font atlas, no font is open\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    // Identify the font, glyphs are referred to by their index in it
+    const FT_Face             face = m_fontHandles->face;
+    std::vector<std::uint8_t> buffer(std::begin(atlasSignature), std::end(atlasSignature));
+    writeAtlasInteger(buffer, atlasVersion, 4);
+    writeAtlasString(buffer, m_info.family);
+    writeAtlasString(buffer, face->style_name ? face->style_name : "");
+    writeAtlasInteger(buffer, static_cast<std::uint64_t>(face->num_glyphs), 4);
+
+    writeAtlasInteger(buffer, m_pages.size(), 4);
+    for (const auto& [characterSize, page] : m_pages)
+    {
+        const Vector2u size = page.texture.getSize();
+
+        writeAtlasInteger(buffer, characterSize, 4);
+        writeAtlasInteger(buffer, static_cast<std::uint64_t>(page.packingAlgorithm), 1);
+        writeAtlasInteger(buffer, size.x, 4);
+        writeAtlasInteger(buffer, size.y, 4);
+        writeAtlasInteger(buffer, page.nextRow, 4);
+        writeAtlasInteger(buffer, page.packedGlyphs, 8);
+        writeAtlasInteger(buffer, page.usedArea, 8);
+
+        writeAtlasInteger(buffer, page.rows.size(), 4);
+        for (const Row& row : page.rows)
+        {
+            writeAtlasInteger(buffer, row.width, 4);
+            writeAtlasInteger(buffer, row.top, 4);
+            writeAtlasInteger(buffer, row.height, 4);
+        }
+
+        writeAtlasInteger(buffer, page.skyline.size(), 4);
+        for (const SkylineNode& node : page.skyline)
+        {
+            writeAtlasInteger(buffer, node.x, 4);
+            writeAtlasInteger(buffer, node.y, 4);
+            writeAtlasInteger(buffer, node.width, 4);
+        }
+
+        writeAtlasInteger(buffer, page.glyphs.size(), 4);
+        for (const auto& [key, glyph] : page.glyphs)
+        {
+            writeAtlasInteger(buffer, key, 8);
+            writeAtlasFloat(buffer, glyph.advance);
+            writeAtlasInteger(buffer, static_cast<std::uint32_t>(glyph.lsbDelta), 4);
+            writeAtlasInteger(buffer, static_cast<std::uint32_t>(glyph.rsbDelta), 4);
+            writeAtlasFloat(buffer, glyph.bounds.position.x);
+            writeAtlasFloat(buffer, glyph.bounds.position.y);
+            writeAtlasFloat(buffer, glyph.bounds.size.x);
+            writeAtlasFloat(buffer, glyph.bounds.size.y);
+            writeAtlasInteger(buffer, static_cast<std::uint32_t>(glyph.textureRect.position.x), 4);
+            writeAtlasInteger(buffer, static_cast<std::uint32_t>(glyph.textureRect.position.y), 4);
+            writeAtlasInteger(buffer, static_cast<std::uint32_t>(glyph.textureRect.size.x), 4);
+            writeAtlasInteger(buffer, static_cast<std::uint32_t>(glyph.textureRect.size.y), 4);
+        }
+
+        // Glyphs are always white, only their alpha channel needs to be stored
+        buffer.insert(buffer.end(), page.alpha.begin(), page.alpha.end());
+    }
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size())))
+    {
+        err() << "Failed to save font atlas\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::loadAtlasFromFile(const std::filesystem::path& filename)
+{
+    if (!m_fontHandles || !m_fontHandles->face)
+    {
+        err() << "Failed to load font atlas, no font is open\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+    {
+        err() << "Failed to open font atlas file\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    const std::vector<std::uint8_t> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    AtlasReader                     reader{buffer};
+
+    // Check that the atlas was saved from the same font
+    const FT_Face       face      = m_fontHandles->face;
+    const std::uint8_t* signature = reader.readBytes(sizeof(atlasSignature));
+    if (!signature || (std::memcmp(signature, atlasSignature, sizeof(atlasSignature)) != 0) ||
+        (reader.readUint32() != atlasVersion))
+    {
+        err() << "Failed to load font atlas, the file is not a font atlas\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    if ((reader.readString() != m_info.family) || (reader.readString() != (face->style_name ? face->style_name : "")) ||
+        (reader.readUint32() != static_cast<std::uint32_t>(face->num_glyphs)))
+    {
+        err() << "Failed to load font atlas, it was saved from a different font\n"
+              << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    // Read all the pages before replacing any of them, so that a truncated file changes nothing
+    std::vector<std::pair<unsigned int, Page>> pages;
+    for (std::size_t pageCount = reader.readCount(1); (pageCount > 0) && !reader.failed; --pageCount)
+    {
+        const unsigned int characterSize = reader.readUint32();
+        const auto         algorithm     = static_cast<PackingAlgorithm>(reader.readInteger(1));
+        const unsigned int width         = reader.readUint32();
+        const Vector2u     size(width, reader.readUint32());
+        if ((algorithm != PackingAlgorithm::Rows && algorithm != PackingAlgorithm::Skyline) || (size.x == 0) ||
+            (size.y == 0) || (size.x > Texture::getMaximumSize()) || (size.y > Texture::getMaximumSize()))
+        {
+            reader.failed = true;
+            break;
+        }
+
+        Page& page        = pages.emplace_back(characterSize, Page(m_isSmooth, algorithm)).second;
+        page.nextRow      = reader.readUint32();
+        page.packedGlyphs = static_cast<std::size_t>(reader.readInteger(8));
+        page.usedArea     = reader.readInteger(8);
+
+        page.rows.clear();
+        for (std::size_t rowCount = reader.readCount(12); rowCount > 0; --rowCount)
+        {
+            const unsigned int rowWidth = reader.readUint32();
+            const unsigned int top      = reader.readUint32();
+            page.rows.emplace_back(top, reader.readUint32()).width = rowWidth;
+        }
+
+        page.skyline.clear();
+        for (std::size_t nodeCount = reader.readCount(12); nodeCount > 0; --nodeCount)
+        {
+            const unsigned int x = reader.readUint32();
+            const unsigned int y = reader.readUint32();
+            page.skyline.push_back({x, y, reader.readUint32()});
+        }
+
+        for (std::size_t glyphCount = reader.readCount(52); glyphCount > 0; --glyphCount)
+        {
+            const std::uint64_t key = reader.readInteger(8);
+            Glyph               glyph;
+            glyph.advance                = reader.readFloat();
+            glyph.lsbDelta               = reader.readInt32();
+            glyph.rsbDelta               = reader.readInt32();
+            glyph.bounds.position.x      = reader.readFloat();
+            glyph.bounds.position.y      = reader.readFloat();
+            glyph.bounds.size.x          = reader.readFloat();
+            glyph.bounds.size.y          = reader.readFloat();
+            glyph.textureRect.position.x = reader.readInt32();
+            glyph.textureRect.position.y = reader.readInt32();
+            glyph.textureRect.size.x     = reader.readInt32();
+            glyph.textureRect.size.y     = reader.readInt32();
+            page.glyphs.try_emplace(key, glyph);
+        }
+
+        // Glyphs must not be packed or drawn outside of the texture
+        if (!reader.failed && !isPageConsistent(page, size))
+        {
+            reader.failed = true;
+            break;
+        }
+
+        const std::uint8_t* alpha = reader.readBytes(std::size_t{size.x} * size.y);
+        if (!alpha)
+            break;
+
+        // Create the texture and fill it with white pixels carrying the stored alpha
+        if (size != page.texture.getSize())
+        {
+            Texture texture;
+            if (!texture.resize(size))
+            {
+                err() << "Failed to create font atlas page texture" << std::endl;
+                return false;
+            }
+
+            texture.setSmooth(page.texture.isSmooth());
+            page.texture.swap(texture);
+        }
+
+        page.alpha.assign(alpha, alpha + std::size_t{size.x} * size.y);
+        page.texture.update(getPagePixels(page.alpha.data(), page.alpha.size()).data());
+    }
+
+    if (reader.failed)
+    {
+        err() << "Failed to load font atlas, the file is corrupted\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    // Replace the pages of the same character sizes
+    for (auto& [characterSize, page] : pages)
+    {
+        if (const auto it = m_pages.find(characterSize); it != m_pages.end())
+        {
+            m_cacheStatistics.evictions += it->second.glyphs.size();
+            m_cacheStatistics.residentBytes -= getTextureBytes(it->second.texture);
+            m_pages.erase(it);
+        }
+
+        page.lastUse = ++m_pageUses;
+        m_cacheStatistics.residentBytes += getTextureBytes(page.texture);
+        m_pages.try_emplace(characterSize, std::move(page));
+    }
+
+    // Stay within the memory budget
+    if (m_memoryBudget != 0)
+        evictPages(nullptr, 0);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isPageConsistent(const Page& page, Vector2u size)
+{
+    const std::uint64_t area = std::uint64_t{size.x} * size.y;
+    if ((page.nextRow > size.y) || (page.usedArea > area) || (page.packedGlyphs > page.glyphs.size()))
+        return false;
+
+    // Rows are stacked from top to bottom, above the next row
+    std::uint64_t rowBottom = 0;
+    for (const Row& row : page.rows)
+    {
+        if ((page.packingAlgorithm != PackingAlgorithm::Rows) || (row.top < rowBottom) || (row.width > size.x))
+            return false;
+
+        rowBottom = std::uint64_t{row.top} + row.height;
+        if (rowBottom > page.nextRow)
+            return false;
+    }
+
+    // Skyline segments cover the whole width of the texture, from left to right
+    std::uint64_t nodeRight = 0;
+    for (const SkylineNode& node : page.skyline)
+    {
+        if ((page.packingAlgorithm != PackingAlgorithm::Skyline) || (node.x != nodeRight) || (node.width == 0) ||
+            (node.y > size.y))
+            return false;
+
+        nodeRight = std::uint64_t{node.x} + node.width;
+    }
+
+    if ((page.packingAlgorithm == PackingAlgorithm::Skyline) && (nodeRight != size.x))
+        return false;
+
+    // Glyphs are drawn from their rectangle in the texture
+    for (const auto& [key, glyph] : page.glyphs)
+    {
+        const IntRect& rect = glyph.textureRect;
+        if ((rect.position.x < 0) || (rect.position.y < 0) || (rect.size.x < 0) || (rect.size.y < 0) ||
+            (std::int64_t{rect.position.x} + rect.size.x > std::int64_t{size.x}) ||
+            (std::int64_t{rect.position.y} + rect.size.y > std::int64_t{size.y}))
+            return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::cleanup()
+{
+    // Drop ownership of shared FreeType pointers
+    m_fontHandles.reset();
+
+    // Reset members
+    m_pages.clear();
+    m_distanceFieldPage.reset();
+    m_distanceFieldGlyphs.clear();
+    m_glyphIndices.clear();
+    m_kernings.clear();
+    m_cacheStatistics = {};
+    std::vector<std::uint8_t>().swap(m_pixelBuffer);
+
+    // Drop the file stream if we held one due to openFromFile or openFromMemory
+    m_stream.reset();
 }
 
 
@@ -459,176 +1377,439 @@ bool Font::openFromStreamImpl(InputStream& stream, std::string_view type)
 ////////////////////////////////////////////////////////////
 Font::Page& Font::loadPage(unsigned int characterSize) const
 {
-    return m_pages.try_emplace(characterSize, m_isSmooth).first->second;
+    Page* page    = nullptr;
+    bool  created = false;
+
+    // All the character sizes share the same page in distance field mode, it must always be smooth
+    if (m_glyphMode == GlyphMode::SignedDistanceField)
+    {
+        created = !m_distanceFieldPage.has_value();
+        if (created)
+            m_distanceFieldPage.emplace(true, m_packingAlgorithm);
+
+        page = &*m_distanceFieldPage;
+    }
+    else
+    {
+        const auto [it, inserted] = m_pages.try_emplace(characterSize, m_isSmooth, m_packingAlgorithm);
+        page                      = &it->second;
+        created                   = inserted;
+    }
+
+    page->lastUse = ++m_pageUses;
+
+    // Make room for the new page within the memory budget
+    if (created)
+    {
+        m_cacheStatistics.residentBytes += getTextureBytes(page->texture);
+
+        if (m_memoryBudget != 0)
+            evictPages(page, 0);
+    }
+
+    return *page;
 }
 
 
 ////////////////////////////////////////////////////////////
-Glyph Font::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+const Glyph& Font::getDistanceFieldGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
 {
-    // The glyph to return
+    GlyphTable&         glyphs = m_distanceFieldGlyphs[characterSize];
+    const std::uint32_t index  = getGlyphIndex(codePoint);
+
+    // Search the scaled glyph into the cache
+    const std::uint64_t key = combine(outlineThickness, bold, index);
+    if (const auto it = glyphs.find(key); it != glyphs.end())
+    {
+        ++m_cacheStatistics.hits;
+        return it->second;
+    }
+
+    // Find or load the glyph at the reference size, outlines are drawn from the same distance field
+    GlyphTable&         referenceGlyphs = loadPage(characterSize).glyphs;
+    const std::uint64_t referenceKey    = combine(0.f, bold, index);
+    auto                referenceIt     = referenceGlyphs.find(referenceKey);
+    if (referenceIt == referenceGlyphs.end())
+    {
+        ++m_cacheStatistics.misses;
+        const Glyph referenceGlyph = loadDistanceFieldGlyph(codePoint, bold);
+        referenceIt                = referenceGlyphs.try_emplace(referenceKey, referenceGlyph).first;
+    }
+    else
+    {
+        ++m_cacheStatistics.hits;
+    }
+
+    const Glyph& reference = referenceIt->second;
+
+    // Scale the metrics to the requested character size, the texture rectangle stays the same
+    const float scale = static_cast<float>(characterSize) / float{distanceFieldSize};
+
     Glyph glyph;
+    glyph.advance         = reference.advance * scale;
+    glyph.lsbDelta        = static_cast<int>(std::lround(static_cast<float>(reference.lsbDelta) * scale));
+    glyph.rsbDelta        = static_cast<int>(std::lround(static_cast<float>(reference.rsbDelta) * scale));
+    glyph.bounds.position = reference.bounds.position * scale;
+    glyph.bounds.size     = reference.bounds.size * scale;
+    glyph.textureRect     = reference.textureRect;
+
+    // Outline glyphs also cover the part of the distance field that the outline spreads over
+    if (const int margin = getDistanceFieldMargin(scale, outlineThickness);
+        (margin > 0) && (reference.textureRect.size.x > 0) && (reference.textureRect.size.y > 0))
+    {
+        glyph.textureRect.position -= Vector2i(margin, margin);
+        glyph.textureRect.size += 2 * Vector2i(margin, margin);
+        glyph.bounds.position -= Vector2f(Vector2i(margin, margin)) * scale;
+        glyph.bounds.size += 2.f * Vector2f(Vector2i(margin, margin)) * scale;
+    }
 
-    // Stop if no font is loaded
-    if (!m_fontHandles)
-        return glyph;
+    return glyphs.try_emplace(key, glyph).first->second;
+}
 
-    // Get our FT_Face
-    FT_Face face = m_fontHandles->face;
-    if (!face)
-        return glyph;
 
-    // Set the character size
-    if (!setCurrentSize(characterSize))
-        return glyph;
+////////////////////////////////////////////////////////////
+Glyph Font::loadDistanceFieldGlyph(char32_t codePoint, bool bold) const
+{
+    // Stop if no font is loaded
+    if (!m_fontHandles || !m_fontHandles->face)
+        return {};
+
+    // Rasterize the glyph at the reference size
+    if (!setCurrentSize(distanceFieldSize))
+        return {};
+
+    const std::optional<GlyphBitmap> bitmap = rasterizeGlyph(m_fontHandles->library,
+                                                             m_fontHandles->face,
+                                                             m_fontHandles->stroker,
+                                                             codePoint,
+                                                             bold,
+                                                             0.f,
+                                                             m_pixelBuffer);
+    if (!bitmap)
+        return {};
+
+    if ((bitmap->size.x == 0) || (bitmap->size.y == 0))
+        return bitmap->glyph;
+
+    // Convert it to a distance field, the spread around the glyph doubles as its padding
+    std::vector<std::uint8_t> fieldPixels;
+    const Vector2u            fieldSize = computeDistanceField(m_pixelBuffer.data(), bitmap->size, fieldPixels);
+
+    return writeGlyph(loadPage(distanceFieldSize), bitmap->glyph, fieldSize, distanceFieldSpread, fieldPixels.data());
+}
 
-    // Load the glyph corresponding to the code point
-    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
-    if (outlineThickness != 0)
-        flags |= FT_LOAD_NO_BITMAP;
-    if (FT_Load_Char(face, codePoint, flags) != 0)
-        return glyph;
 
-    // Retrieve the glyph
-    FT_Glyph glyphDesc = nullptr;
-    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
-        return glyph;
+////////////////////////////////////////////////////////////
+const Shader* Font::getDistanceFieldShader(unsigned int characterSize, float outlineThickness) const
+{
+    if ((m_glyphMode != GlyphMode::SignedDistanceField) || !Shader::isAvailable())
+        return nullptr;
 
-    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
-    const FT_Pos weight  = 1 << 6;
-    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
-    if (outline)
+    // Outlines are drawn by moving the edge of the glyph outwards in the distance field
+    float threshold = 0.5f;
+    if ((outlineThickness != 0) && (characterSize > 0))
     {
-        if (bold)
+        const float scale   = static_cast<float>(characterSize) / float{distanceFieldSize};
+        const float outline = std::min(std::abs(outlineThickness) / scale, float{distanceFieldSpread});
+        threshold -= outline / (2.f * float{distanceFieldSpread});
+    }
+
+    // Shaders are shared by all the thresholds that map to the same alpha value
+    const auto               key    = static_cast<int>(std::lround(threshold * 255.f));
+    std::shared_ptr<Shader>& shader = m_distanceFieldShaders[key];
+    if (!shader)
+    {
+        shader = std::make_shared<Shader>();
+        if (shader->loadFromMemory(distanceFieldFragmentShader, Shader::Type::Fragment))
         {
-            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
-            FT_Outline_Embolden(&outlineGlyph->outline, weight);
+            shader->setUniform("sf_texture", Shader::CurrentTexture);
+            shader->setUniform("sf_threshold", static_cast<float>(key) / 255.f);
         }
-
-        if (outlineThickness != 0)
+        else
         {
-            FT_Stroker stroker = m_fontHandles->stroker;
-
-            FT_Stroker_Set(stroker,
-                           static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
-                           FT_STROKER_LINECAP_ROUND,
-                           FT_STROKER_LINEJOIN_ROUND,
-                           0);
-            FT_Glyph_Stroke(&glyphDesc, stroker, true);
+            err() << "Failed to compile the distance field shader, glyphs will be drawn without it" << std::endl;
         }
     }
 
-    // Convert the glyph to a bitmap (i.e. rasterize it)
-    // Warning! After this line, do not read any data from glyphDesc directly, use
-    // bitmapGlyph.root to access the FT_Glyph data.
-    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
-    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
-    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+    return (shader->getNativeHandle() != 0) ? shader.get() : nullptr;
+}
 
-    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
-    if (!outline)
-    {
-        if (bold)
-            FT_Bitmap_Embolden(m_fontHandles->library, &bitmap, weight, weight);
 
-        if (outlineThickness != 0)
-            err() << "Failed to outline glyph (no fallback available)" << std::endl;
-    }
+////////////////////////////////////////////////////////////
+float Font::getGlyphTexturePadding(unsigned int characterSize, float outlineThickness) const
+{
+    if (m_glyphMode != GlyphMode::SignedDistanceField)
+        return float{glyphPadding};
 
-    // Compute the glyph's advance offset
-    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
-    if (bold)
-        glyph.advance += static_cast<float>(weight) / float{1 << 6};
+    // The spread around distance field glyphs is their padding, outline glyphs already cover part of it
+    const float scale = static_cast<float>(characterSize) / float{distanceFieldSize};
+    return float{distanceFieldSpread} - static_cast<float>(getDistanceFieldMargin(scale, outlineThickness));
+}
 
-    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
-    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
 
-    Vector2u size(bitmap.width, bitmap.rows);
+////////////////////////////////////////////////////////////
+Glyph Font::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    // Stop if no font is loaded
+    if (!m_fontHandles || !m_fontHandles->face)
+        return {};
 
-    if ((size.x > 0) && (size.y > 0))
+    // Set the character size
+    if (!setCurrentSize(characterSize))
+        return {};
+
+    const std::optional<GlyphBitmap> bitmap = rasterizeGlyph(m_fontHandles->library,
+                                                             m_fontHandles->face,
+                                                             m_fontHandles->stroker,
+                                                             codePoint,
+                                                             bold,
+                                                             outlineThickness,
+                                                             m_pixelBuffer);
+    if (!bitmap)
+        return {};
+
+    if (bitmap->outlineFailed)
+        err() << "Failed to outline glyph (no fallback available)" << std::endl;
+
+    return writeGlyph(loadPage(characterSize), bitmap->glyph, bitmap->size, glyphPadding, m_pixelBuffer.data());
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::loadGlyphsConcurrently(Page&               page,
+                                  std::u32string_view codePoints,
+                                  unsigned int        characterSize,
+                                  bool                bold,
+                                  float               outlineThickness) const
+{
+    FontHandles& fontHandles = *m_fontHandles;
+
+    // Collect the glyphs missing from the page, several code points may share the same glyph
+    std::vector<std::pair<std::uint64_t, char32_t>> missingGlyphs;
+    std::unordered_set<std::uint64_t>               queuedKeys;
+    for (const char32_t codePoint : codePoints)
     {
-        // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        const unsigned int padding = 2;
+        // Glyphs already cached or queued are hits, the queued ones are counted as misses when they are packed
+        const std::uint64_t key = combine(outlineThickness, bold, getGlyphIndex(codePoint));
+        if ((page.glyphs.find(key) == page.glyphs.end()) && queuedKeys.insert(key).second)
+            missingGlyphs.emplace_back(key, codePoint);
+        else
+            ++m_cacheStatistics.hits;
+    }
 
-        size += 2u * Vector2u(padding, padding);
+    // The calling thread uses the main face, the other threads use the faces of the pool
+    const std::size_t threadCount = std::min(std::size_t{m_rasterizationThreads}, missingGlyphs.size());
+    if (threadCount < 2)
+        return;
 
-        // Get the glyphs page corresponding to the character size
-        Page& page = loadPage(characterSize);
+    // The pool keeps the faces of all the configured threads, only the ones needed are used
+    const std::size_t workerCount = std::min(fontHandles.resizeFacePool(m_rasterizationThreads - 1), threadCount - 1);
+    if (workerCount == 0)
+        return;
 
-        // Find a good position for the new glyph into the texture
-        glyph.textureRect = findGlyphRect(page, size);
+    // The rasterized glyphs wait in a window of slots until they are packed, to bound the memory held by their pixels
+    constexpr std::size_t windowSize = 256;
 
-        // Make sure the texture data is positioned in the center
-        // of the allocated texture rectangle
-        glyph.textureRect.position += Vector2i(padding, padding);
-        glyph.textureRect.size -= 2 * Vector2i(padding, padding);
+    struct RasterizedGlyph
+    {
+        std::optional<GlyphBitmap> bitmap;
+        std::vector<std::uint8_t>  pixels;
+        bool                       ready{};
+    };
 
-        // Compute the glyph's bounding box
-        glyph.bounds.position = Vector2f(Vector2i(bitmapGlyph->left, -bitmapGlyph->top));
-        glyph.bounds.size     = Vector2f(Vector2u(bitmap.width, bitmap.rows));
+    // Shared by the threads: the slots are only handed over under the mutex, through their `ready` flag
+    struct SharedState
+    {
+        std::vector<RasterizedGlyph> slots;
+        std::atomic<std::size_t>     nextGlyph{};
+        std::size_t                  packedGlyphs{};
+        bool                         stopped{};
+        std::mutex                   mutex;
+        std::condition_variable      condition;
+    } state;
+    state.slots.resize(std::min(windowSize, missingGlyphs.size()));
+
+    const auto rasterize = [&](std::size_t i, FT_Library library, FT_Face face, FT_Stroker stroker)
+    {
+        RasterizedGlyph& slot = state.slots[i % windowSize];
+        slot.bitmap = rasterizeGlyph(library, face, stroker, missingGlyphs[i].second, bold, outlineThickness, slot.pixels);
 
-        // Resize the pixel buffer to the new size and fill it with transparent white pixels
-        m_pixelBuffer.resize(std::size_t{size.x} * std::size_t{size.y} * 4);
+        {
+            const std::lock_guard lock(state.mutex);
+            slot.ready = true;
+        }
 
-        std::uint8_t* current = m_pixelBuffer.data();
-        std::uint8_t* end     = current + size.x * size.y * 4;
+        state.condition.notify_all();
+    };
 
-        while (current != end)
+    // Joins the workers when leaving the function, even if starting one of them or packing a glyph threw
+    struct Workers
+    {
+        explicit Workers(SharedState& sharedState) : state(sharedState)
         {
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 0;
         }
 
-        // Extract the glyph's pixels from the bitmap
-        const std::uint8_t* pixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        ~Workers()
         {
-            // Pixels are 1 bit monochrome values
-            for (unsigned int y = padding; y < size.y - padding; ++y)
             {
-                for (unsigned int x = padding; x < size.x - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = x + y * size.x;
-                    m_pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
-                }
-                pixels += bitmap.pitch;
+                const std::lock_guard lock(state.mutex);
+                state.stopped = true;
             }
+
+            state.condition.notify_all();
+
+            for (std::thread& thread : threads)
+                thread.join();
         }
-        else
-        {
-            // Pixels are 8 bit gray levels
-            for (unsigned int y = padding; y < size.y - padding; ++y)
+
+        Workers(const Workers&)            = delete;
+        Workers& operator=(const Workers&) = delete;
+
+        SharedState&             state;
+        std::vector<std::thread> threads;
+    } workers(state);
+
+    workers.threads.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i)
+    {
+        FontHandles& pooledHandles = *fontHandles.facePool[i];
+        workers.threads.emplace_back(
+            [&state, &rasterize, &pooledHandles, &missingGlyphs, characterSize]
             {
-                for (unsigned int x = padding; x < size.x - padding; ++x)
+                // The size was already validated on the main face, so errors don't need to be reported here
+                if ((pooledHandles.face->size->metrics.x_ppem != characterSize) &&
+                    (FT_Set_Pixel_Sizes(pooledHandles.face, 0, characterSize) != FT_Err_Ok))
+                    return;
+
+                for (std::size_t index = state.nextGlyph++; index < missingGlyphs.size(); index = state.nextGlyph++)
                 {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index      = x + y * size.x;
-                    m_pixelBuffer[index * 4 + 3] = pixels[x - padding];
+                    // Wait until the glyph that used the slot before was packed
+                    {
+                        std::unique_lock lock(state.mutex);
+                        state.condition.wait(lock,
+                                             [&state, index]
+                                             { return state.stopped || (index < state.packedGlyphs + windowSize); });
+                        if (state.stopped)
+                            return;
+                    }
+
+                    rasterize(index, pooledHandles.library, pooledHandles.face, pooledHandles.stroker);
                 }
-                pixels += bitmap.pitch;
-            }
+            });
+    }
+
+    // Pack the glyphs in the order they were requested, so that they end up where a single thread would put them
+    for (std::size_t i = 0; i < missingGlyphs.size(); ++i)
+    {
+        RasterizedGlyph& rasterizedGlyph = state.slots[i % windowSize];
+
+        // Help rasterizing until the glyph is claimed, the glyphs up to it always have a free slot
+        for (std::size_t next = state.nextGlyph; next <= i; next = state.nextGlyph)
+        {
+            if (state.nextGlyph.compare_exchange_weak(next, next + 1))
+                rasterize(next, fontHandles.library, fontHandles.face, fontHandles.stroker);
+        }
+
+        // Wait for the thread that claimed the glyph
+        {
+            std::unique_lock lock(state.mutex);
+            state.condition.wait(lock, [&rasterizedGlyph] { return rasterizedGlyph.ready; });
+        }
+
+        Glyph glyph;
+        if (rasterizedGlyph.bitmap)
+        {
+            if (rasterizedGlyph.bitmap->outlineFailed)
+                err() << "Failed to outline glyph (no fallback available)" << std::endl;
+
+            glyph = writeGlyph(page,
+                               rasterizedGlyph.bitmap->glyph,
+                               rasterizedGlyph.bitmap->size,
+                               glyphPadding,
+                               rasterizedGlyph.pixels.data());
+        }
+
+        page.glyphs.try_emplace(missingGlyphs[i].first, glyph);
+        ++m_cacheStatistics.misses;
+
+        // Hand the slot over to the glyph that comes a window later
+        {
+            const std::lock_guard lock(state.mutex);
+            rasterizedGlyph.ready = false;
+            ++state.packedGlyphs;
         }
 
-        // Write the pixels to the texture
-        const auto dest       = Vector2u(glyph.textureRect.position) - Vector2u(padding, padding);
-        const auto updateSize = Vector2u(glyph.textureRect.size) + 2u * Vector2u(padding, padding);
-        page.texture.update(m_pixelBuffer.data(), updateSize, dest);
+        state.condition.notify_all();
     }
+}
 
-    // Delete the FT glyph
-    FT_Done_Glyph(glyphDesc);
 
-    // Done :)
+////////////////////////////////////////////////////////////
+Glyph Font::writeGlyph(Page& page, Glyph glyph, Vector2u size, unsigned int padding, const std::uint8_t* pixels) const
+{
+    if ((size.x == 0) || (size.y == 0))
+        return glyph;
+
+    // Find a good position for the new glyph into the texture
+    const IntRect rect = findGlyphRect(page, size);
+
+    // Make sure the texture data is positioned in the center
+    // of the allocated texture rectangle
+    glyph.textureRect = rect;
+    glyph.textureRect.position += Vector2i(Vector2u(padding, padding));
+    glyph.textureRect.size -= 2 * Vector2i(Vector2u(padding, padding));
+
+    // Don't overwrite the white square if the glyph didn't fit
+    if (rect.size != Vector2i(size))
+        return glyph;
+
+    // Keep the copy of the alpha channel up to date
+    const auto        dest       = Vector2u(rect.position);
+    const auto        updateSize = size;
+    const std::size_t pitch      = page.texture.getSize().x;
+    for (unsigned int y = 0; y < updateSize.y; ++y)
+    {
+        std::uint8_t*       alpha      = page.alpha.data() + (dest.y + y) * pitch + dest.x;
+        const std::uint8_t* glyphPixel = pixels + std::size_t{y} * updateSize.x * 4;
+        for (unsigned int x = 0; x < updateSize.x; ++x)
+            alpha[x] = glyphPixel[x * 4 + 3];
+    }
+
+    // Write the pixels to the texture, or only record the modified rows if glyphs are being preloaded
+    if (page.staging)
+    {
+        page.stagingTop    = std::min(page.stagingTop, dest.y);
+        page.stagingBottom = std::max(page.stagingBottom, dest.y + updateSize.y);
+    }
+    else
+    {
+        page.texture.update(pixels, updateSize, dest);
+    }
+
     return glyph;
 }
 
 
 ////////////////////////////////////////////////////////////
 IntRect Font::findGlyphRect(Page& page, Vector2u size) const
+{
+    const std::optional<IntRect> rect = (page.packingAlgorithm == PackingAlgorithm::Skyline)
+                                            ? findSkylineRect(page, size)
+                                            : findRowRect(page, size);
+
+    // Fall back to the white square reserved for underlines if the glyph doesn't fit
+    if (!rect)
+        return {{0, 0}, {2, 2}};
+
+    ++page.packedGlyphs;
+    page.usedArea += std::uint64_t{size.x} * size.y;
+
+    return *rect;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<IntRect> Font::findRowRect(Page& page, Vector2u size) const
 {
     // Find the line that fits well the glyph
     Row*  row       = nullptr;
@@ -661,28 +1842,8 @@ IntRect Font::findGlyphRect(Page& page, Vector2u size) const
         while ((page.nextRow + rowHeight >= page.texture.getSize().y) || (size.x >= page.texture.getSize().x))
         {
             // Not enough space: resize the texture if possible
-            const Vector2u textureSize = page.texture.getSize();
-            if ((textureSize.x * 2 <= Texture::getMaximumSize()) && (textureSize.y * 2 <= Texture::getMaximumSize()))
-            {
-                // Make the texture 2 times bigger
-                Texture newTexture;
-                if (!newTexture.resize(textureSize * 2u))
-                {
-                    err() << "Failed to create new page texture" << std::endl;
-                    return {{0, 0}, {2, 2}};
-                }
-
-                newTexture.setSmooth(m_isSmooth);
-                newTexture.update(page.texture);
-                page.texture.swap(newTexture);
-            }
-            else
-            {
-                // Oops, we've reached the maximum texture size...
-                err() << "Failed to add a new character to the font: the maximum texture size has been reached"
-                      << std::endl;
-                return {{0, 0}, {2, 2}};
-            }
+            if (!resizePage(page))
+                return std::nullopt;
         }
 
         // We can now create the new row
@@ -701,6 +1862,302 @@ IntRect Font::findGlyphRect(Page& page, Vector2u size) const
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<IntRect> Font::findSkylineRect(Page& page, Vector2u size) const
+{
+    std::vector<SkylineNode>& skyline = page.skyline;
+
+    for (;;)
+    {
+        const Vector2u textureSize = page.texture.getSize();
+
+        // Find the node where the top of the glyph would be the lowest, ties are broken by the leftmost node
+        std::size_t  bestIndex = skyline.size();
+        unsigned int bestY     = 0;
+        unsigned int bestTop   = 0;
+
+        for (std::size_t i = 0; i < skyline.size(); ++i)
+        {
+            if (skyline[i].x + size.x > textureSize.x)
+                break;
+
+            // The glyph rests on the highest of the nodes it spans
+            unsigned int y         = 0;
+            unsigned int remaining = size.x;
+            for (std::size_t j = i; remaining > 0; ++j)
+            {
+                y = std::max(y, skyline[j].y);
+                remaining -= std::min(remaining, skyline[j].width);
+            }
+
+            if ((y + size.y <= textureSize.y) && ((bestIndex == skyline.size()) || (y + size.y < bestTop)))
+            {
+                bestIndex = i;
+                bestY     = y;
+                bestTop   = y + size.y;
+            }
+        }
+
+        if (bestIndex < skyline.size())
+        {
+            const Vector2u position(skyline[bestIndex].x, bestY);
+
+            // Raise the skyline over the glyph, shrinking or removing the nodes that it now covers
+            skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(bestIndex), {position.x, bestTop, size.x});
+
+            const unsigned int right = position.x + size.x;
+            const auto         next  = skyline.begin() + static_cast<std::ptrdiff_t>(bestIndex) + 1;
+            auto               it    = next;
+            while ((it != skyline.end()) && (it->x + it->width <= right))
+                ++it;
+
+            it = skyline.erase(next, it);
+            if ((it != skyline.end()) && (it->x < right))
+            {
+                it->width -= right - it->x;
+                it->x = right;
+            }
+
+            // Merge neighbor nodes at the same height
+            for (std::size_t i = 0; i + 1 < skyline.size();)
+            {
+                if (skyline[i].y == skyline[i + 1].y)
+                {
+                    skyline[i].width += skyline[i + 1].width;
+                    skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i) + 1);
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+
+            return IntRect(Rect<unsigned int>(position, size));
+        }
+
+        // Not enough space: resize the texture if possible
+        if (!resizePage(page))
+            return std::nullopt;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::beginStaging(Page& page) const
+{
+    // The glyphs are written to the copy of the alpha channel, which always holds the whole page
+    page.staging = true;
+
+    // Nothing was modified yet
+    page.stagingTop    = page.texture.getSize().y;
+    page.stagingBottom = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::endStaging(Page& page) const
+{
+    // Upload all the modified rows at once, they are contiguous in the copy of the alpha channel
+    if (page.stagingTop < page.stagingBottom)
+    {
+        const unsigned int width  = page.texture.getSize().x;
+        const unsigned int height = page.stagingBottom - page.stagingTop;
+        page.texture.update(getPagePixels(page.alpha.data() + std::size_t{page.stagingTop} * width,
+                                          std::size_t{width} * height)
+                                .data(),
+                            {width, height},
+                            {0, page.stagingTop});
+    }
+
+    page.staging = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::evictPages(const Page* keep, std::size_t extraBytes) const
+{
+    while (m_cacheStatistics.residentBytes + extraBytes > m_memoryBudget)
+    {
+        // Find the least recently used page
+        const Page* oldest   = nullptr;
+        auto        oldestIt = m_pages.end();
+        for (auto it = m_pages.begin(); it != m_pages.end(); ++it)
+        {
+            if ((&it->second != keep) && (!oldest || (it->second.lastUse < oldest->lastUse)))
+            {
+                oldest   = &it->second;
+                oldestIt = it;
+            }
+        }
+
+        if (m_distanceFieldPage && (&*m_distanceFieldPage != keep) &&
+            (!oldest || (m_distanceFieldPage->lastUse < oldest->lastUse)))
+        {
+            oldest   = &*m_distanceFieldPage;
+            oldestIt = m_pages.end();
+        }
+
+        // Nothing left to evict
+        if (!oldest)
+            return;
+
+        m_cacheStatistics.evictions += oldest->glyphs.size();
+        m_cacheStatistics.residentBytes -= getTextureBytes(oldest->texture);
+
+        if (oldestIt != m_pages.end())
+        {
+            m_pages.erase(oldestIt);
+        }
+        else
+        {
+            // The scaled glyphs refer to the distance field page too
+            m_distanceFieldPage.reset();
+            for (auto& [characterSize, glyphs] : m_distanceFieldGlyphs)
+                glyphs.clear();
+        }
+
+        clearLookups();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::resetPage(Page& page) const
+{
+    const bool          staged  = page.staging;
+    const std::uint64_t lastUse = page.lastUse;
+
+    m_cacheStatistics.evictions += page.glyphs.size();
+    m_cacheStatistics.residentBytes -= getTextureBytes(page.texture);
+
+    page         = Page(page.texture.isSmooth(), page.packingAlgorithm);
+    page.lastUse = lastUse;
+
+    m_cacheStatistics.residentBytes += getTextureBytes(page.texture);
+
+    // The scaled glyphs refer to the distance field page too
+    // The tables are cleared rather than erased, since callers may hold references to them
+    if (m_distanceFieldPage && (&*m_distanceFieldPage == &page))
+    {
+        for (auto& [characterSize, glyphs] : m_distanceFieldGlyphs)
+            glyphs.clear();
+    }
+
+    clearLookups();
+
+    // Keep staging the glyphs of a preload into the new texture
+    if (staged)
+        beginStaging(page);
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::clearLookups() const
+{
+    // The cached glyph indices and kerning values grow with the code points used, they are cheap
+    // to look up again so they are simply dropped along with the pages to stay within the budget
+    m_glyphIndices.clear();
+    m_kernings.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::resizePage(Page& page) const
+{
+    const Vector2u textureSize = page.texture.getSize();
+    if ((textureSize.x * 2 > Texture::getMaximumSize()) || (textureSize.y * 2 > Texture::getMaximumSize()))
+    {
+        // Oops, we've reached the maximum texture size...
+        err() << "Failed to add a new character to the font: the maximum texture size has been reached" << std::endl;
+        return false;
+    }
+
+    // Make room for the bigger texture within the memory budget
+    const std::size_t extraBytes = getTextureBytes(page.texture) * 3;
+    if (m_memoryBudget != 0)
+    {
+        evictPages(&page, extraBytes);
+
+        if (m_cacheStatistics.residentBytes + extraBytes > m_memoryBudget)
+        {
+            // The page alone would exceed the budget: start it over, its glyphs will be packed again when requested
+            if (page.packedGlyphs > 0)
+            {
+                resetPage(page);
+                return true;
+            }
+
+            err() << "Failed to add a new character to the font: the memory budget has been reached" << std::endl;
+            return false;
+        }
+    }
+
+    // Make the texture 2 times bigger
+    Texture newTexture;
+    if (!newTexture.resize(textureSize * 2u))
+    {
+        err() << "Failed to create new page texture" << std::endl;
+        return false;
+    }
+
+    newTexture.setSmooth(page.texture.isSmooth());
+
+    // Enlarge the copy of the alpha channel, the new area is transparent
+    std::vector<std::uint8_t> newAlpha(std::size_t{textureSize.x} * textureSize.y * 4);
+    for (unsigned int y = 0; y < textureSize.y; ++y)
+    {
+        std::memcpy(newAlpha.data() + std::size_t{y} * textureSize.x * 2,
+                    page.alpha.data() + std::size_t{y} * textureSize.x,
+                    textureSize.x);
+    }
+
+    page.alpha.swap(newAlpha);
+
+    if (page.staging)
+    {
+        // The whole texture will be uploaded from the copy of the alpha channel at the end of the preload
+        page.stagingTop    = 0;
+        page.stagingBottom = textureSize.y * 2;
+    }
+    else
+    {
+        newTexture.update(page.texture);
+    }
+
+    page.texture.swap(newTexture);
+    ++page.textureResizes;
+    m_cacheStatistics.residentBytes += extraBytes;
+
+    // The new area on the right is empty from top to bottom, the one below is already covered by the skyline
+    if (page.packingAlgorithm == PackingAlgorithm::Skyline)
+    {
+        if (page.skyline.back().y == 0)
+            page.skyline.back().width += textureSize.x;
+        else
+            page.skyline.push_back({textureSize.x, 0, textureSize.x});
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t Font::getGlyphIndex(char32_t codePoint) const
+{
+    FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+
+    if (!face)
+        return 0;
+
+    // Search the index into the cache, or ask the font and cache it
+    const auto [it, inserted] = m_glyphIndices.try_emplace(codePoint);
+    if (inserted)
+        it->second = FT_Get_Char_Index(face, codePoint);
+
+    return it->second;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Font::setCurrentSize(unsigned int characterSize) const
 {
@@ -743,7 +2200,7 @@ bool Font::setCurrentSize(unsigned int characterSize) const
 
 
 ////////////////////////////////////////////////////////////
-Font::Page::Page(bool smooth)
+Font::Page::Page(bool smooth, PackingAlgorithm algorithm) : packingAlgorithm(algorithm)
 {
     // Make sure that the texture is initialized by default
     Image image({128, 128}, Color::Transparent);
@@ -760,6 +2217,15 @@ Font::Page::Page(bool smooth)
     }
 
     texture.setSmooth(smooth);
+
+    // Keep a copy of the alpha channel, so that the texture never has to be read back
+    alpha.resize(std::size_t{image.getSize().x} * image.getSize().y);
+    for (std::size_t i = 0; i < alpha.size(); ++i)
+        alpha[i] = image.getPixelsPtr()[i * 4 + 3];
+
+    // The skyline starts below the white square, like the first row
+    if (packingAlgorithm == PackingAlgorithm::Skyline)
+        skyline.push_back({0, nextRow, texture.getSize().x});
 }
 
 } // namespace sf
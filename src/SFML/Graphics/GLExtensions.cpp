@@ -79,7 +79,17 @@ void extensionSanityCheck()
     check(GLEXT_framebuffer_object_dependencies);
     check(GLEXT_framebuffer_blit_dependencies);
     check(GLEXT_framebuffer_multisample_dependencies);
+    check(GLEXT_map_buffer_range_dependencies);
+    check(GLEXT_vertex_array_object_dependencies);
     check(GLEXT_copy_buffer_dependencies);
+    check(GLEXT_uniform_buffer_object_dependencies);
+    check(GLEXT_sync_dependencies);
+    check(GLEXT_core_profile_dependencies);
+    check(GLEXT_instanced_arrays_dependencies);
+    check(GLEXT_timer_query_dependencies);
+    check(GLEXT_get_program_binary_dependencies);
+    check(GLEXT_get_program_binary_core_dependencies);
+    check(GLEXT_buffer_storage_dependencies);
 #endif
 }
 } // namespace
@@ -65,16 +65,17 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 // Core since 1.1
 // 1.1 does not support GL_STREAM_DRAW so we just define it to GL_DYNAMIC_DRAW
-#define GLEXT_vertex_buffer_object ::sf::priv::SF_GL_OES_vertex_buffer_object
-#define GLEXT_glBindBuffer         glBindBuffer
-#define GLEXT_glBufferData         glBufferData
-#define GLEXT_glBufferSubData      glBufferSubData
-#define GLEXT_glDeleteBuffers      glDeleteBuffers
-#define GLEXT_glGenBuffers         glGenBuffers
-#define GLEXT_GL_ARRAY_BUFFER      GL_ARRAY_BUFFER
-#define GLEXT_GL_DYNAMIC_DRAW      GL_DYNAMIC_DRAW
-#define GLEXT_GL_STATIC_DRAW       GL_STATIC_DRAW
-#define GLEXT_GL_STREAM_DRAW       GL_DYNAMIC_DRAW
+#define GLEXT_vertex_buffer_object    ::sf::priv::SF_GL_OES_vertex_buffer_object
+#define GLEXT_glBindBuffer            glBindBuffer
+#define GLEXT_glBufferData            glBufferData
+#define GLEXT_glBufferSubData         glBufferSubData
+#define GLEXT_glDeleteBuffers         glDeleteBuffers
+#define GLEXT_glGenBuffers            glGenBuffers
+#define GLEXT_GL_ARRAY_BUFFER         GL_ARRAY_BUFFER
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER GL_ELEMENT_ARRAY_BUFFER
+#define GLEXT_GL_DYNAMIC_DRAW         GL_DYNAMIC_DRAW
+#define GLEXT_GL_STATIC_DRAW          GL_STATIC_DRAW
+#define GLEXT_GL_STREAM_DRAW          GL_DYNAMIC_DRAW
 
 #define GLEXT_vertex_buffer_object_dependencies \
     ::sf::priv::SF_GL_OES_vertex_buffer_object, glBindBuffer, glBufferData, glBufferSubData, glDeleteBuffers, glGenBuffers
@@ -168,6 +169,73 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_glCopyBufferSubData \
     glCopyBufferSubData // Placeholder to satisfy the compiler, entry point is not loaded in GLES
 
+// Core since 3.0 - OES_element_index_uint
+#define GLEXT_element_index_uint false
+
+// Core since 3.0 - EXT_instanced_arrays, EXT_draw_instanced
+#define GLEXT_instanced_arrays false
+#define GLEXT_glDrawArraysInstanced \
+    glDrawArraysInstanced // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glVertexAttribDivisor \
+    glVertexAttribDivisor // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetAttribLocation \
+    glGetAttribLocation // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glVertexAttribPointer \
+    glVertexAttribPointer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glEnableVertexAttribArray \
+    glEnableVertexAttribArray // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDisableVertexAttribArray \
+    glDisableVertexAttribArray // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - EXT_disjoint_timer_query
+#define GLEXT_timer_query false
+#define GLEXT_glGenQueries \
+    glGenQueries // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteQueries \
+    glDeleteQueries // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glQueryCounter \
+    glQueryCounter // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetQueryObjectiv \
+    glGetQueryObjectiv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetQueryObjectui64v \
+    glGetQueryObjectui64v // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_TIMESTAMP              0
+#define GLEXT_GL_QUERY_RESULT           0
+#define GLEXT_GL_QUERY_RESULT_AVAILABLE 0
+
+// Core since 3.0 - OES_get_program_binary
+#define GLEXT_get_program_binary false
+#define GLEXT_glGetProgramBinary \
+    glGetProgramBinary // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glProgramBinary \
+    glProgramBinary // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glProgramParameteri \
+    glProgramParameteri // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetProgramiv \
+    glGetProgramiv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_PROGRAM_BINARY_LENGTH           0
+#define GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0
+#define GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS      0
+#define GLEXT_GL_LINK_STATUS                     0
+
+// Core since 3.0 - OES_vertex_array_object
+#define GLEXT_vertex_array_object false
+
+// Core since 3.0
+#define GLEXT_uniform_buffer_object false
+#define GLEXT_glBindBufferBase \
+    glBindBufferBase // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetUniformBlockIndex \
+    glGetUniformBlockIndex // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glUniformBlockBinding \
+    glUniformBlockBinding // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_UNIFORM_BUFFER              0
+#define GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS 0
+#define GLEXT_GL_INVALID_INDEX               0xFFFFFFFFu
+
+// Core profile contexts don't exist in GLES 1
+#define GLEXT_core_profile false
+
 // Core since 3.0 - EXT_sRGB
 #define GLEXT_texture_sRGB    false
 #define GLEXT_GL_SRGB8_ALPHA8 0
@@ -189,6 +257,7 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 // Core since 1.1
 #define GLEXT_GL_DEPTH_COMPONENT GL_DEPTH_COMPONENT
 #define GLEXT_GL_CLAMP           GL_CLAMP
+#define GLEXT_element_index_uint true
 
 // The following extensions are listed chronologically
 // Extension macro first, followed by tokens then
@@ -232,21 +301,24 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_vertex_buffer_object             SF_GLAD_GL_ARB_vertex_buffer_object
 #define GLEXT_GL_ARRAY_BUFFER                  GL_ARRAY_BUFFER_ARB
 #define GLEXT_GL_DYNAMIC_DRAW                  GL_DYNAMIC_DRAW_ARB
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER          GL_ELEMENT_ARRAY_BUFFER_ARB
 #define GLEXT_GL_READ_ONLY                     GL_READ_ONLY_ARB
 #define GLEXT_GL_STATIC_DRAW                   GL_STATIC_DRAW_ARB
 #define GLEXT_GL_STREAM_DRAW                   GL_STREAM_DRAW_ARB
+#define GLEXT_GL_STREAM_READ                   GL_STREAM_READ_ARB
 #define GLEXT_GL_WRITE_ONLY                    GL_WRITE_ONLY_ARB
 #define GLEXT_glBindBuffer                     glBindBufferARB
 #define GLEXT_glBufferData                     glBufferDataARB
 #define GLEXT_glBufferSubData                  glBufferSubDataARB
 #define GLEXT_glDeleteBuffers                  glDeleteBuffersARB
 #define GLEXT_glGenBuffers                     glGenBuffersARB
+#define GLEXT_glGetBufferSubData               glGetBufferSubDataARB
 #define GLEXT_glMapBuffer                      glMapBufferARB
 #define GLEXT_glUnmapBuffer                    glUnmapBufferARB
 
 #define GLEXT_vertex_buffer_object_dependencies                                                                    \
     SF_GLAD_GL_ARB_vertex_buffer_object, glBindBufferARB, glBufferDataARB, glBufferSubDataARB, glDeleteBuffersARB, \
-        glGenBuffersARB, glMapBufferARB, glUnmapBufferARB
+        glGenBuffersARB, glGetBufferSubDataARB, glMapBufferARB, glUnmapBufferARB
 
 // Core since 2.0 - ARB_shading_language_100
 #define GLEXT_shading_language_100     SF_GLAD_GL_ARB_shading_language_100
@@ -314,6 +386,12 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_texture_sRGB                         SF_GLAD_GL_EXT_texture_sRGB
 #define GLEXT_GL_SRGB8_ALPHA8                      GL_SRGB8_ALPHA8_EXT
 
+// Core since 2.1 - ARB_pixel_buffer_object
+// Checked against the core version, the buffer entry points are the ARB_vertex_buffer_object ones
+#define GLEXT_pixel_buffer_object                  SF_GLAD_GL_VERSION_2_1
+#define GLEXT_GL_PIXEL_PACK_BUFFER                 GL_PIXEL_PACK_BUFFER
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER               GL_PIXEL_UNPACK_BUFFER
+
 // Core since 3.0 - EXT_framebuffer_object
 #define GLEXT_framebuffer_object                   SF_GLAD_GL_EXT_framebuffer_object
 #define GLEXT_glBindRenderbuffer                   glBindRenderbufferEXT
@@ -364,6 +442,25 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_framebuffer_multisample_dependencies \
     SF_GLAD_GL_EXT_framebuffer_multisample, glRenderbufferStorageMultisampleEXT
 
+// Core since 3.0 - ARB_map_buffer_range
+#define GLEXT_map_buffer_range            SF_GLAD_GL_ARB_map_buffer_range
+#define GLEXT_glMapBufferRange            glMapBufferRange
+#define GLEXT_GL_MAP_WRITE_BIT            GL_MAP_WRITE_BIT
+#define GLEXT_GL_MAP_INVALIDATE_RANGE_BIT GL_MAP_INVALIDATE_RANGE_BIT
+#define GLEXT_GL_MAP_UNSYNCHRONIZED_BIT   GL_MAP_UNSYNCHRONIZED_BIT
+
+#define GLEXT_map_buffer_range_dependencies SF_GLAD_GL_ARB_map_buffer_range, glMapBufferRange
+
+// Core since 3.0 - ARB_vertex_array_object
+// Checked against the core version, core profile contexts don't have to advertise the extension
+#define GLEXT_vertex_array_object  SF_GLAD_GL_VERSION_3_0
+#define GLEXT_glGenVertexArrays    glGenVertexArrays
+#define GLEXT_glBindVertexArray    glBindVertexArray
+#define GLEXT_glDeleteVertexArrays glDeleteVertexArrays
+
+#define GLEXT_vertex_array_object_dependencies \
+    SF_GLAD_GL_VERSION_3_0, glGenVertexArrays, glBindVertexArray, glDeleteVertexArrays
+
 // Core since 3.1 - ARB_copy_buffer
 #define GLEXT_copy_buffer          SF_GLAD_GL_ARB_copy_buffer
 #define GLEXT_GL_COPY_READ_BUFFER  GL_COPY_READ_BUFFER
@@ -372,10 +469,101 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 #define GLEXT_copy_buffer_dependencies SF_GLAD_GL_ARB_copy_buffer, glCopyBufferSubData
 
+// Core since 3.1 - ARB_uniform_buffer_object
+// Checked against the core version, core profile contexts don't have to advertise the extension
+#define GLEXT_uniform_buffer_object          SF_GLAD_GL_VERSION_3_1
+#define GLEXT_glBindBufferBase               glBindBufferBase
+#define GLEXT_glGetUniformBlockIndex         glGetUniformBlockIndex
+#define GLEXT_glUniformBlockBinding          glUniformBlockBinding
+#define GLEXT_GL_UNIFORM_BUFFER              GL_UNIFORM_BUFFER
+#define GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS GL_MAX_UNIFORM_BUFFER_BINDINGS
+#define GLEXT_GL_INVALID_INDEX               GL_INVALID_INDEX
+
+#define GLEXT_uniform_buffer_object_dependencies \
+    SF_GLAD_GL_VERSION_3_1, glBindBufferBase, glGetUniformBlockIndex, glUniformBlockBinding
+
 // Core since 3.2 - ARB_geometry_shader4
 #define GLEXT_geometry_shader4         SF_GLAD_GL_ARB_geometry_shader4
 #define GLEXT_GL_GEOMETRY_SHADER       GL_GEOMETRY_SHADER_ARB
 
+// Core since 3.2 - ARB_sync
+#define GLEXT_sync                          SF_GLAD_GL_ARB_sync
+#define GLEXT_glFenceSync                   glFenceSync
+#define GLEXT_glClientWaitSync              glClientWaitSync
+#define GLEXT_glDeleteSync                  glDeleteSync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT    GL_SYNC_FLUSH_COMMANDS_BIT
+#define GLEXT_GL_TIMEOUT_EXPIRED            GL_TIMEOUT_EXPIRED
+
+#define GLEXT_sync_dependencies SF_GLAD_GL_ARB_sync, glFenceSync, glClientWaitSync, glDeleteSync
+
+// Core since 3.2 - core profile
+// Core profile contexts don't expose ARB_shader_objects, the programmable pipeline
+// is driven through the core 2.0 program object entry points instead
+#define GLEXT_core_profile                SF_GLAD_GL_VERSION_3_2
+#define GLEXT_GL_CONTEXT_PROFILE_MASK     GL_CONTEXT_PROFILE_MASK
+#define GLEXT_GL_CONTEXT_CORE_PROFILE_BIT GL_CONTEXT_CORE_PROFILE_BIT
+
+#define GLEXT_core_profile_dependencies                                                                          \
+    SF_GLAD_GL_VERSION_3_2, glCreateShader, glShaderSource, glCompileShader, glGetShaderiv, glGetShaderInfoLog, \
+        glCreateProgram, glAttachShader, glBindAttribLocation, glLinkProgram, glGetProgramiv,                  \
+        glGetProgramInfoLog, glDeleteShader, glDeleteProgram, glUseProgram, glGetAttribLocation,               \
+        glGetUniformLocation, glUniform1i, glUniform1f, glUniformMatrix4fv, glMapBufferRange
+
+// Core since 3.3 - ARB_draw_instanced, ARB_instanced_arrays
+// The generic vertex attribute entry points are core since 2.0
+#define GLEXT_instanced_arrays           SF_GLAD_GL_VERSION_3_3
+#define GLEXT_glDrawArraysInstanced      glDrawArraysInstanced
+#define GLEXT_glVertexAttribDivisor      glVertexAttribDivisor
+#define GLEXT_glGetAttribLocation        glGetAttribLocation
+#define GLEXT_glVertexAttribPointer      glVertexAttribPointer
+#define GLEXT_glEnableVertexAttribArray  glEnableVertexAttribArray
+#define GLEXT_glDisableVertexAttribArray glDisableVertexAttribArray
+
+#define GLEXT_instanced_arrays_dependencies                                                                         \
+    SF_GLAD_GL_VERSION_3_3, glDrawArraysInstanced, glVertexAttribDivisor, glGetAttribLocation, glVertexAttribPointer, \
+        glEnableVertexAttribArray, glDisableVertexAttribArray
+
+// Core since 3.3 - ARB_timer_query
+#define GLEXT_timer_query               SF_GLAD_GL_VERSION_3_3
+#define GLEXT_glGenQueries              glGenQueries
+#define GLEXT_glDeleteQueries           glDeleteQueries
+#define GLEXT_glQueryCounter            glQueryCounter
+#define GLEXT_glGetQueryObjectiv        glGetQueryObjectiv
+#define GLEXT_glGetQueryObjectui64v     glGetQueryObjectui64v
+#define GLEXT_GL_TIMESTAMP              GL_TIMESTAMP
+#define GLEXT_GL_QUERY_RESULT           GL_QUERY_RESULT
+#define GLEXT_GL_QUERY_RESULT_AVAILABLE GL_QUERY_RESULT_AVAILABLE
+
+#define GLEXT_timer_query_dependencies                                                                 \
+    SF_GLAD_GL_VERSION_3_3, glGenQueries, glDeleteQueries, glQueryCounter, glGetQueryObjectiv, \
+        glGetQueryObjectui64v
+
+// Core since 4.1 - ARB_get_program_binary
+// Also checked against the core version, core profile contexts don't have to advertise the extension
+#define GLEXT_get_program_binary                 (SF_GLAD_GL_VERSION_4_1 || SF_GLAD_GL_ARB_get_program_binary)
+#define GLEXT_glGetProgramBinary                 glGetProgramBinary
+#define GLEXT_glProgramBinary                    glProgramBinary
+#define GLEXT_glProgramParameteri                glProgramParameteri
+#define GLEXT_glGetProgramiv                     glGetProgramiv
+#define GLEXT_GL_PROGRAM_BINARY_LENGTH           GL_PROGRAM_BINARY_LENGTH
+#define GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS      GL_NUM_PROGRAM_BINARY_FORMATS
+#define GLEXT_GL_LINK_STATUS                     GL_LINK_STATUS
+
+#define GLEXT_get_program_binary_dependencies \
+    SF_GLAD_GL_ARB_get_program_binary, glGetProgramBinary, glProgramBinary, glProgramParameteri, glGetProgramiv
+#define GLEXT_get_program_binary_core_dependencies \
+    SF_GLAD_GL_VERSION_4_1, glGetProgramBinary, glProgramBinary, glProgramParameteri, glGetProgramiv
+
+// Core since 4.4 - ARB_buffer_storage
+#define GLEXT_buffer_storage        SF_GLAD_GL_ARB_buffer_storage
+#define GLEXT_glBufferStorage       glBufferStorage
+#define GLEXT_GL_MAP_PERSISTENT_BIT GL_MAP_PERSISTENT_BIT
+#define GLEXT_GL_MAP_COHERENT_BIT   GL_MAP_COHERENT_BIT
+
+#define GLEXT_buffer_storage_dependencies SF_GLAD_GL_ARB_buffer_storage, glBufferStorage
+
 #endif
 
 // OpenGL Versions
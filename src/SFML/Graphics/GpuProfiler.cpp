@@ -0,0 +1,303 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/GpuProfiler.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <ostream>
+#include <utility>
+
+
+namespace
+{
+// Scopes kept when their results are never collected, the oldest ones are dropped first
+constexpr std::size_t maxPendingScopes = 4096;
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+struct GpuProfiler::QueryPool
+{
+    ~QueryPool()
+    {
+        if (!queries.empty())
+            glCheck(GLEXT_glDeleteQueries(static_cast<GLsizei>(queries.size()), queries.data()));
+    }
+
+    std::vector<GLuint> queries;     //!< All the query objects created in the context
+    std::vector<GLuint> freeQueries; //!< Query objects whose results were read
+};
+
+
+////////////////////////////////////////////////////////////
+GpuProfiler::GpuProfiler() = default;
+
+
+////////////////////////////////////////////////////////////
+GpuProfiler::~GpuProfiler()
+{
+    // Unregister query pools with the contexts if they haven't already been destroyed
+    for (auto& entry : m_queryPools)
+    {
+        auto queryPool = entry.second.lock();
+
+        if (queryPool)
+            unregisterUnsharedGlObject(std::move(queryPool));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool GpuProfiler::isAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        ensureExtensionsInit();
+
+        return GLEXT_timer_query;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void GpuProfiler::beginScope(std::string name)
+{
+    Scope& scope = m_scopes.emplace_back();
+    scope.name   = std::move(name);
+    scope.depth  = m_openScopes.size();
+
+    if (isAvailable())
+    {
+        scope.contextId  = Context::getActiveContextId();
+        scope.beginQuery = issueTimestamp();
+    }
+    else
+    {
+        const std::int64_t now = m_clock.getElapsedTime().asMicroseconds();
+
+        // CPU times are relative to the first scope too
+        if (!m_hasCpuEpoch)
+        {
+            m_cpuEpoch    = now;
+            m_hasCpuEpoch = true;
+        }
+
+        scope.begin = now - m_cpuEpoch;
+    }
+
+    // Elements of a deque stay in place when other elements are added or removed at its ends
+    m_openScopes.push_back(&scope);
+}
+
+
+////////////////////////////////////////////////////////////
+bool GpuProfiler::endScope()
+{
+    if (m_openScopes.empty())
+        return false;
+
+    Scope& scope = *m_openScopes.back();
+    m_openScopes.pop_back();
+
+    if (!isAvailable())
+        scope.end = m_clock.getElapsedTime().asMicroseconds() - m_cpuEpoch;
+    else if (scope.contextId == Context::getActiveContextId())
+        scope.endQuery = issueTimestamp();
+    else
+        scope.dropped = true; // Timestamps of different contexts can't be compared
+
+    scope.closed = true;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void GpuProfiler::finishFrame()
+{
+    if (!m_openScopes.empty())
+    {
+        err() << "Dropping " << m_openScopes.size()
+              << " profile scope(s) that were not ended with endProfileScope before the end of the frame" << std::endl;
+
+        for (Scope* scope : m_openScopes)
+        {
+            scope->closed  = true;
+            scope->dropped = true;
+        }
+
+        m_openScopes.clear();
+    }
+
+    // Don't let the scopes pile up if their results are never collected
+    while (m_scopes.size() > maxPendingScopes)
+    {
+        releaseQueries(m_scopes.front());
+        m_scopes.pop_front();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void GpuProfiler::collectResults(std::vector<RenderTarget::ProfileResult>& results)
+{
+    const bool gpuTime = isAvailable();
+
+    // Results are handed out in opening order, so stop at the first scope that isn't complete
+    while (!m_scopes.empty() && m_scopes.front().closed)
+    {
+        Scope& scope = m_scopes.front();
+
+        if (scope.dropped)
+        {
+            releaseQueries(scope);
+            m_scopes.pop_front();
+            continue;
+        }
+
+        if (gpuTime)
+        {
+            // Queries can only be read in the context that issued them
+            if (scope.contextId != Context::getActiveContextId())
+            {
+                // The context was destroyed along with the queries, their results are lost
+                if (m_queryPools[scope.contextId].expired())
+                {
+                    m_scopes.pop_front();
+                    continue;
+                }
+
+                break;
+            }
+
+            // Never wait for a result, it will be read by a later call instead
+            GLint beginAvailable = GL_FALSE;
+            GLint endAvailable   = GL_FALSE;
+            glCheck(GLEXT_glGetQueryObjectiv(scope.beginQuery, GLEXT_GL_QUERY_RESULT_AVAILABLE, &beginAvailable));
+            glCheck(GLEXT_glGetQueryObjectiv(scope.endQuery, GLEXT_GL_QUERY_RESULT_AVAILABLE, &endAvailable));
+
+            if ((beginAvailable == GL_FALSE) || (endAvailable == GL_FALSE))
+                break;
+
+            GLuint64 begin = 0;
+            GLuint64 end   = 0;
+            glCheck(GLEXT_glGetQueryObjectui64v(scope.beginQuery, GLEXT_GL_QUERY_RESULT, &begin));
+            glCheck(GLEXT_glGetQueryObjectui64v(scope.endQuery, GLEXT_GL_QUERY_RESULT, &end));
+
+            // GPU timestamps have an arbitrary origin, make them relative to the first scope
+            if (!m_hasGpuEpoch)
+            {
+                m_gpuEpoch    = begin;
+                m_hasGpuEpoch = true;
+            }
+
+            scope.begin = static_cast<std::int64_t>((begin - m_gpuEpoch) / 1000);
+            scope.end   = static_cast<std::int64_t>((end - m_gpuEpoch) / 1000);
+
+            releaseQueries(scope);
+        }
+
+        RenderTarget::ProfileResult& result = results.emplace_back();
+
+        result.name     = std::move(scope.name);
+        result.depth    = scope.depth;
+        result.start    = microseconds(scope.begin);
+        result.duration = microseconds(scope.end - scope.begin);
+        result.gpuTime  = gpuTime;
+
+        m_scopes.pop_front();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int GpuProfiler::issueTimestamp()
+{
+    std::weak_ptr<QueryPool>&  entry     = m_queryPools[Context::getActiveContextId()];
+    std::shared_ptr<QueryPool> queryPool = entry.lock();
+
+    if (!queryPool)
+    {
+        queryPool = std::make_shared<QueryPool>();
+        entry     = queryPool;
+
+        // Register the pool with the current context so its queries are destroyed along with it
+        registerUnsharedGlObject(queryPool);
+    }
+
+    GLuint query = 0;
+
+    if (queryPool->freeQueries.empty())
+    {
+        glCheck(GLEXT_glGenQueries(1, &query));
+        queryPool->queries.push_back(query);
+    }
+    else
+    {
+        query = queryPool->freeQueries.back();
+        queryPool->freeQueries.pop_back();
+    }
+
+    // Timestamps rather than elapsed time queries, since those can't be nested
+    glCheck(GLEXT_glQueryCounter(query, GLEXT_GL_TIMESTAMP));
+
+    return query;
+}
+
+
+////////////////////////////////////////////////////////////
+void GpuProfiler::releaseQueries(const Scope& scope)
+{
+    const auto it = m_queryPools.find(scope.contextId);
+    if (it == m_queryPools.end())
+        return;
+
+    // Queries of destroyed contexts were deleted along with them
+    const auto queryPool = it->second.lock();
+    if (!queryPool)
+        return;
+
+    if (scope.beginQuery)
+        queryPool->freeQueries.push_back(scope.beginQuery);
+    if (scope.endQuery)
+        queryPool->freeQueries.push_back(scope.endQuery);
+}
+
+} // namespace sf::priv
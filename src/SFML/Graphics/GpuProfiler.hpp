@@ -0,0 +1,192 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Measures the time spent in named rendering scopes
+///
+/// Scopes are timed with OpenGL timestamp queries whose
+/// results are read back once they are available, so that
+/// profiling never stalls the pipeline. Without timer
+/// queries, the scopes are timed on the CPU instead.
+///
+////////////////////////////////////////////////////////////
+class GpuProfiler : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    GpuProfiler();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~GpuProfiler();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    GpuProfiler(const GpuProfiler&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the system supports timer queries
+    ///
+    /// \return `true` if scopes are timed on the GPU
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open a new scope, nested in the currently open one if any
+    ///
+    /// \param name Name of the scope
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginScope(std::string name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close the most recently opened scope
+    ///
+    /// \return `false` if no scope is open
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool endScope();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Drop the scopes that were opened but not closed
+    ///
+    /// Called at the end of each frame: a scope still open
+    /// at this point will never be balanced, and would block
+    /// the results of all the scopes opened after it.
+    ///
+    /// The oldest scopes are dropped as well if too many of
+    /// them are waiting for their results to be collected.
+    ///
+    ////////////////////////////////////////////////////////////
+    void finishFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move the results of the complete scopes to a list
+    ///
+    /// Scopes whose queries are not available yet are kept
+    /// for a later call, results are appended in the order
+    /// the scopes were opened.
+    ///
+    /// \param results List to append the results to
+    ///
+    ////////////////////////////////////////////////////////////
+    void collectResults(std::vector<RenderTarget::ProfileResult>& results);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Scope waiting for its results
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Scope
+    {
+        std::string   name;         //!< Name of the scope
+        std::size_t   depth{};      //!< Nesting level
+        std::uint64_t contextId{};  //!< Context that owns the queries of the scope
+        unsigned int  beginQuery{}; //!< Timestamp query issued when the scope was opened
+        unsigned int  endQuery{};   //!< Timestamp query issued when the scope was closed
+        std::int64_t  begin{};      //!< CPU time when the scope was opened, in microseconds
+        std::int64_t  end{};        //!< CPU time when the scope was closed, in microseconds
+        bool          closed{};     //!< Was the scope closed yet?
+        bool          dropped{};    //!< Must the scope be discarded instead of reported?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Query objects created in a single context
+    ///
+    ////////////////////////////////////////////////////////////
+    struct QueryPool;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Issue a timestamp query in the active context
+    ///
+    /// Reuses a released query object of the context if possible.
+    ///
+    /// \return Query object
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int issueTimestamp();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give the query objects of a scope back to their context
+    ///
+    /// \param scope Scope whose queries are released
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseQueries(const Scope& scope);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    // Query objects are not shared between contexts
+    using QueryPoolMap = std::unordered_map<std::uint64_t, std::weak_ptr<QueryPool>>;
+
+    std::deque<Scope>   m_scopes;        //!< Scopes waiting for their results, in opening order
+    std::vector<Scope*> m_openScopes;    //!< Scopes not closed yet, innermost last
+    QueryPoolMap        m_queryPools;    //!< Query objects per context
+    Clock               m_clock;         //!< Clock timing the scopes when timer queries are unavailable
+    std::int64_t        m_cpuEpoch{};    //!< CPU time of the first scope, in microseconds
+    bool                m_hasCpuEpoch{}; //!< Was the CPU time of the first scope taken yet?
+    std::uint64_t       m_gpuEpoch{};    //!< GPU time of the first scope, in nanoseconds
+    bool                m_hasGpuEpoch{}; //!< Was the GPU time of the first scope read yet?
+};
+
+} // namespace sf::priv
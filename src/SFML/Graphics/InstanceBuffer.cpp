@@ -0,0 +1,268 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/InstanceBuffer.hpp>
+#include <SFML/Graphics/Shader.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <utility>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace InstanceBufferImpl
+{
+GLenum usageToGlEnum(sf::InstanceBuffer::Usage usage)
+{
+    switch (usage)
+    {
+        case sf::InstanceBuffer::Usage::Static:
+            return GLEXT_GL_STATIC_DRAW;
+        case sf::InstanceBuffer::Usage::Dynamic:
+            return GLEXT_GL_DYNAMIC_DRAW;
+        default:
+            return GLEXT_GL_STREAM_DRAW;
+    }
+}
+} // namespace InstanceBufferImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void InstanceBuffer::Instance::setTransform(const Transform& newTransform)
+{
+    // Keep the two linear columns and the translation of the 4x4 matrix
+    const float* matrix = newTransform.getMatrix();
+    transform           = {matrix[0], matrix[1], matrix[4], matrix[5], matrix[12], matrix[13]};
+}
+
+
+////////////////////////////////////////////////////////////
+Transform InstanceBuffer::Instance::getTransform() const
+{
+    return {transform[0], transform[2], transform[4], transform[1], transform[3], transform[5], 0.f, 0.f, 1.f};
+}
+
+
+////////////////////////////////////////////////////////////
+InstanceBuffer::InstanceBuffer(Usage usage) : m_usage(usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+InstanceBuffer::InstanceBuffer(const InstanceBuffer& copy) : GlResource(copy), m_usage(copy.m_usage)
+{
+    if (!copy.m_instances.empty())
+    {
+        if (!create(copy.m_instances.size()))
+        {
+            err() << "Could not create instance buffer for copying" << std::endl;
+            return;
+        }
+
+        if (!update(copy.m_instances.data()))
+            err() << "Could not copy instance buffer" << std::endl;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+InstanceBuffer::~InstanceBuffer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool InstanceBuffer::create(std::size_t instanceCount)
+{
+    m_instances.assign(instanceCount, Instance{});
+
+    if (!isAvailable())
+        return true;
+
+    const TransientContextLock contextLock;
+
+    if (!m_buffer)
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create instance buffer, generation failed" << std::endl;
+        m_instances.clear();
+        return false;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                               static_cast<GLsizeiptrARB>(sizeof(Instance) * instanceCount),
+                               m_instances.data(),
+                               InstanceBufferImpl::usageToGlEnum(m_usage)));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t InstanceBuffer::getInstanceCount() const
+{
+    return m_instances.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool InstanceBuffer::update(const Instance* instances)
+{
+    return update(instances, m_instances.size(), 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool InstanceBuffer::update(const Instance* instances, std::size_t instanceCount, unsigned int offset)
+{
+    // Sanity checks
+    if (!instances)
+        return false;
+
+    if (offset && (offset + instanceCount > m_instances.size()))
+        return false;
+
+    // Check if we need to resize the buffer
+    const bool resize = instanceCount >= m_instances.size();
+    if (resize)
+        m_instances.resize(instanceCount);
+
+    std::copy(instances, instances + instanceCount, m_instances.begin() + offset);
+
+    if (!m_buffer)
+        return true;
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    // Resize or orphan the buffer before uploading
+    if (resize)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(sizeof(Instance) * instanceCount),
+                                   nullptr,
+                                   InstanceBufferImpl::usageToGlEnum(m_usage)));
+    }
+
+    glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                  static_cast<GLintptrARB>(sizeof(Instance) * offset),
+                                  static_cast<GLsizeiptrARB>(sizeof(Instance) * instanceCount),
+                                  instances));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+InstanceBuffer& InstanceBuffer::operator=(const InstanceBuffer& right)
+{
+    InstanceBuffer temp(right);
+
+    swap(temp);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void InstanceBuffer::swap(InstanceBuffer& right) noexcept
+{
+    std::swap(m_instances, right.m_instances);
+    std::swap(m_buffer, right.m_buffer);
+    std::swap(m_usage, right.m_usage);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int InstanceBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void InstanceBuffer::setUsage(Usage usage)
+{
+    m_usage = usage;
+}
+
+
+////////////////////////////////////////////////////////////
+InstanceBuffer::Usage InstanceBuffer::getUsage() const
+{
+    return m_usage;
+}
+
+
+////////////////////////////////////////////////////////////
+bool InstanceBuffer::isAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_vertex_buffer_object && GLEXT_instanced_arrays;
+    }();
+
+    return available && Shader::isAvailable();
+}
+
+
+////////////////////////////////////////////////////////////
+void swap(InstanceBuffer& left, InstanceBuffer& right) noexcept
+{
+    left.swap(right);
+}
+
+} // namespace sf
@@ -0,0 +1,213 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderCommandList.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <cassert>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace RenderCommandListImpl
+{
+// Get the index of the geometry holding vertices of the given list type
+std::size_t getGeometryIndex(sf::PrimitiveType type)
+{
+    switch (type)
+    {
+        case sf::PrimitiveType::Points:
+            return 0;
+        case sf::PrimitiveType::Lines:
+            return 1;
+        default:
+            assert(type == sf::PrimitiveType::Triangles && "Recorded vertices must be lists");
+            return 2;
+    }
+}
+
+
+// Tell whether two commands drawing vertices owned by the list can be merged together
+bool areStatesCompatible(const sf::RenderStates& left, const sf::RenderStates& right)
+{
+    return (left.blendMode == right.blendMode) && (left.stencilMode == right.stencilMode) &&
+           (left.texture == right.texture) && (left.coordinateType == right.coordinateType) &&
+           (left.shader == right.shader);
+}
+} // namespace RenderCommandListImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void RenderCommandList::clear()
+{
+    m_commands.clear();
+
+    for (Geometry& geometry : m_geometry)
+        geometry = Geometry();
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderCommandList::isEmpty() const
+{
+    return m_commands.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderCommandList::getCommandCount() const
+{
+    return m_commands.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderCommandList::getVertexCount() const
+{
+    std::size_t count = 0;
+    for (const Geometry& geometry : m_geometry)
+        count += geometry.count;
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderCommandList::recordVertices(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
+    Geometry& geometry = m_geometry[RenderCommandListImpl::getGeometryIndex(type)];
+
+    // Extend the last command if it draws the vertices right before these ones
+    const bool merge = !m_commands.empty() && !m_commands.back().vertexBuffer && (m_commands.back().type == type) &&
+                       RenderCommandListImpl::areStatesCompatible(m_commands.back().states, states);
+
+    if (merge)
+    {
+        m_commands.back().count += vertexCount;
+    }
+    else
+    {
+        Command command;
+        command.type   = type;
+        command.first  = geometry.count;
+        command.count  = vertexCount;
+        command.states = states;
+        m_commands.push_back(command);
+    }
+
+    geometry.vertices.insert(geometry.vertices.end(), vertices, vertices + vertexCount);
+    geometry.count += vertexCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderCommandList::recordBuffer(const VertexBuffer&   vertexBuffer,
+                                     const IndexBuffer*    indexBuffer,
+                                     const InstanceBuffer* instanceBuffer,
+                                     std::size_t           first,
+                                     std::size_t           count,
+                                     const RenderStates&   states)
+{
+    Command command;
+    command.vertexBuffer   = &vertexBuffer;
+    command.indexBuffer    = indexBuffer;
+    command.instanceBuffer = instanceBuffer;
+    command.type           = vertexBuffer.getPrimitiveType();
+    command.first          = first;
+    command.count          = count;
+    command.states         = states;
+    m_commands.push_back(command);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderCommandList::upload()
+{
+    if (!VertexBuffer::isAvailable())
+        return;
+
+    static constexpr PrimitiveType types[] = {PrimitiveType::Points, PrimitiveType::Lines, PrimitiveType::Triangles};
+
+    for (std::size_t i = 0; i < m_geometry.size(); ++i)
+    {
+        Geometry& geometry = m_geometry[i];
+        if (geometry.vertices.empty())
+            continue;
+
+        geometry.buffer = VertexBuffer(types[i], VertexBuffer::Usage::Static);
+
+        if (geometry.buffer.create(geometry.count) && geometry.buffer.update(geometry.vertices.data()))
+        {
+            // The vertices are only needed in system memory when they are drawn from there
+            geometry.vertices.clear();
+            geometry.vertices.shrink_to_fit();
+        }
+        else
+        {
+            geometry.buffer = VertexBuffer();
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderCommandList::draw(RenderTarget& target, RenderStates states) const
+{
+    for (const Command& command : m_commands)
+    {
+        RenderStates commandStates = command.states;
+        commandStates.transform    = states.transform * command.states.transform;
+
+        if (command.instanceBuffer)
+        {
+            target.drawInstanced(*command.vertexBuffer, *command.instanceBuffer, commandStates);
+        }
+        else if (command.indexBuffer)
+        {
+            target.draw(*command.vertexBuffer, *command.indexBuffer, command.first, command.count, commandStates);
+        }
+        else if (command.vertexBuffer)
+        {
+            target.draw(*command.vertexBuffer, command.first, command.count, commandStates);
+        }
+        else
+        {
+            const Geometry& geometry = m_geometry[RenderCommandListImpl::getGeometryIndex(command.type)];
+
+            if (geometry.buffer.getVertexCount())
+                target.draw(geometry.buffer, command.first, command.count, commandStates);
+            else
+                target.draw(geometry.vertices.data() + command.first, command.count, command.type, commandStates);
+        }
+    }
+}
+
+} // namespace sf
@@ -25,13 +25,19 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CoreRenderBackend.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/GpuProfiler.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/InstanceBuffer.hpp>
+#include <SFML/Graphics/RenderCommandList.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/VertexTransform.hpp>
 
 #include <SFML/Window/Context.hpp>
 
@@ -39,13 +45,19 @@
 #include <SFML/System/Err.hpp>
 
 #include <algorithm>
+#include <initializer_list>
 #include <mutex>
 #include <ostream>
+#include <sstream>
+#include <string_view>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
 
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 
 
 namespace
@@ -85,6 +97,31 @@ bool isActive(std::uint64_t id)
     return (it != getContextRenderTargetMap().end()) && (it->second == id);
 }
 
+// Rendering statistics are only gathered if enabled at build time, so that they cost nothing otherwise
+#ifdef SFML_ENABLE_RENDER_STATISTICS
+constexpr bool statisticsEnabled = true;
+#else
+constexpr bool statisticsEnabled = false;
+#endif
+
+// Write a string as a JSON string literal
+void writeJsonString(std::ostream& stream, std::string_view string)
+{
+    static constexpr std::string_view hexDigits = "0123456789abcdef";
+
+    stream << '"';
+    for (const char character : string)
+    {
+        if ((character == '"') || (character == '\\'))
+            stream << '\\' << character;
+        else if (const auto code = static_cast<unsigned char>(character); code < 0x20)
+            stream << "\\u00" << hexDigits[code >> 4] << hexDigits[code & 0xF];
+        else
+            stream << character;
+    }
+    stream << '"';
+}
+
 // Convert an sf::BlendMode::Factor constant to the corresponding OpenGL constant.
 std::uint32_t factorToGlConstant(sf::BlendMode::Factor blendFactor)
 {
@@ -191,15 +228,200 @@ std::uint32_t stencilFunctionToGlConstant(sf::StencilComparison comparison)
     assert(false);
     return GL_ALWAYS;
 }
+
+
+// Convert an sf::PrimitiveType constant to the corresponding OpenGL constant.
+std::uint32_t primitiveTypeToGlConstant(sf::PrimitiveType type)
+{
+    static constexpr sf::priv::EnumArray<sf::PrimitiveType, std::uint32_t, 6> modes =
+        {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+    return modes[type];
+}
+
+
+// Get the primitive type used by a batch holding primitives of the given type
+// Strips and fans are converted to lists, so that they can be merged together
+sf::PrimitiveType getBatchPrimitiveType(sf::PrimitiveType type)
+{
+    switch (type)
+    {
+        case sf::PrimitiveType::Points:
+            return sf::PrimitiveType::Points;
+        case sf::PrimitiveType::Lines:
+        case sf::PrimitiveType::LineStrip:
+            return sf::PrimitiveType::Lines;
+        default:
+            return sf::PrimitiveType::Triangles;
+    }
+}
+
+
+// Tell whether primitives drawn with the given render states can share a batch, ignoring their transforms
+bool canShareBatch(const sf::RenderStates& left, const sf::RenderStates& right)
+{
+    return (left.blendMode == right.blendMode) && (left.stencilMode == right.stencilMode) &&
+           (left.texture == right.texture) && (left.coordinateType == right.coordinateType) &&
+           (left.shader == right.shader);
+}
+
+
+// Tell whether two bounding rectangles overlap
+// Rectangles that only share an edge don't, since no pixel is rasterized by both of them
+bool boundsOverlap(const sf::FloatRect& left, const sf::FloatRect& right)
+{
+    return (left.position.x < right.position.x + right.size.x) && (right.position.x < left.position.x + left.size.x) &&
+           (left.position.y < right.position.y + right.size.y) && (right.position.y < left.position.y + left.size.y);
+}
+
+
+// Size of the cells of the grid that deferred draws are bucketed in, to find the draws they overlap
+constexpr float deferredCellSize = 64.f;
+
+// Draws covering more cells than this are checked against every queued draw instead
+constexpr int maxDeferredCells = 16;
+
+// Get the range of grid cells covered by a bounding rectangle
+// Returns false if the rectangle is too large (or too far away) to be bucketed
+bool getDeferredCells(const sf::FloatRect& bounds, sf::Vector2i& first, sf::Vector2i& last)
+{
+    const float left   = std::floor(bounds.position.x / deferredCellSize);
+    const float top    = std::floor(bounds.position.y / deferredCellSize);
+    const float right  = std::floor((bounds.position.x + bounds.size.x) / deferredCellSize);
+    const float bottom = std::floor((bounds.position.y + bounds.size.y) / deferredCellSize);
+
+    // Written so that NaNs fail the test too
+    constexpr float limit = 1 << 20;
+    if (!((left > -limit) && (top > -limit) && (right < limit) && (bottom < limit)))
+        return false;
+
+    first = sf::Vector2i(static_cast<int>(left), static_cast<int>(top));
+    last  = sf::Vector2i(static_cast<int>(right), static_cast<int>(bottom));
+
+    return (last.x - first.x + 1) * (last.y - first.y + 1) <= maxDeferredCells;
+}
+
+
+// Vertex shader of the built-in instancing program
+// The instance transform is passed as its two linear columns and its translation
+constexpr const char* instancingVertexShader = R"(
+#version 110
+
+attribute vec2 sf_position;
+attribute vec4 sf_color;
+attribute vec2 sf_texCoords;
+attribute vec2 sf_instanceColumn0;
+attribute vec2 sf_instanceColumn1;
+attribute vec2 sf_instanceTranslation;
+attribute vec4 sf_instanceColor;
+attribute vec4 sf_instanceTextureRect;
+
+varying vec4 sf_fragColor;
+varying vec2 sf_fragTexCoords;
+
+void main()
+{
+    vec2 position = sf_instanceColumn0 * sf_position.x + sf_instanceColumn1 * sf_position.y + sf_instanceTranslation;
+    vec2 texCoords = sf_instanceTextureRect.xy + sf_texCoords * sf_instanceTextureRect.zw;
+
+    gl_Position = gl_ModelViewProjectionMatrix * vec4(position, 0.0, 1.0);
+    sf_fragTexCoords = (gl_TextureMatrix[0] * vec4(texCoords, 0.0, 1.0)).xy;
+    sf_fragColor = sf_color * sf_instanceColor;
+}
+)";
+
+// Fragment shader of the built-in instancing program
+constexpr const char* instancingFragmentShader = R"(
+#version 110
+
+uniform sampler2D sf_texture;
+uniform float sf_textured;
+
+varying vec4 sf_fragColor;
+varying vec2 sf_fragTexCoords;
+
+void main()
+{
+    vec4 texel = texture2D(sf_texture, sf_fragTexCoords);
+    gl_FragColor = sf_fragColor * mix(vec4(1.0), texel, sf_textured);
+}
+)";
 } // namespace RenderTargetImpl
 } // namespace
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+struct RenderTarget::InstancingProgram
+{
+    Shader shader;                  //!< Shader program
+    bool   loaded{};                //!< Did the program compile and link successfully?
+    GLint  position{-1};            //!< Location of the vertex position attribute
+    GLint  color{-1};               //!< Location of the vertex color attribute
+    GLint  texCoords{-1};           //!< Location of the vertex texture coordinates attribute
+    GLint  instanceColumn0{-1};     //!< Location of the first column of the instance transform
+    GLint  instanceColumn1{-1};     //!< Location of the second column of the instance transform
+    GLint  instanceTranslation{-1}; //!< Location of the translation of the instance transform
+    GLint  instanceColor{-1};       //!< Location of the instance color attribute
+    GLint  instanceTextureRect{-1}; //!< Location of the instance texture rectangle attribute
+};
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::DeferredQueue::Cell::operator==(const Cell& other) const
+{
+    return (layer == other.layer) && (position == other.position);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTarget::DeferredQueue::CellHash::operator()(const Cell& cell) const
+{
+    const auto x = static_cast<std::uint32_t>(cell.position.x);
+    const auto y = static_cast<std::uint32_t>(cell.position.y);
+
+    return std::hash<std::uint64_t>()((std::uint64_t{x} << 32) | y) ^ (std::hash<int>()(cell.layer) << 1);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTarget::DeferredQueue::StatesHash::operator()(const RenderStates& states) const
+{
+    // Render states that can share a batch have the same resources, the modes only rarely differ
+    return std::hash<const void*>()(states.texture) ^ (std::hash<const void*>()(states.shader) << 1) ^
+           static_cast<std::size_t>(states.coordinateType);
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::DeferredQueue::StatesEqual::operator()(const RenderStates& left, const RenderStates& right) const
+{
+    return RenderTargetImpl::canShareBatch(left, right);
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::RenderTarget() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::~RenderTarget() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::RenderTarget(RenderTarget&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget& RenderTarget::operator=(RenderTarget&&) noexcept = default;
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color)
 {
+    // Pending draws must end up below the cleared contents
+    flushBatch();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -218,6 +440,9 @@ void RenderTarget::clear(Color color)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clearStencil(StencilValue stencilValue)
 {
+    // Pending draws must end up below the cleared contents
+    flushBatch();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -236,6 +461,9 @@ void RenderTarget::clearStencil(StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color, StencilValue stencilValue)
 {
+    // Pending draws must end up below the cleared contents
+    flushBatch();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -255,6 +483,9 @@ void RenderTarget::clear(Color color, StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::setView(const View& view)
 {
+    // Pending draws must be rendered with the previous view
+    flushBatch();
+
     m_view              = view;
     m_cache.viewChanged = true;
 }
@@ -352,6 +583,131 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
     if (!vertices || (vertexCount == 0))
         return;
 
+    // Textures attached to a framebuffer must be rebound on every draw, see setupDraw
+    const bool fboAttachment = states.texture && states.texture->m_fboAttachment;
+
+    if (m_deferredQueue.enabled && !fboAttachment)
+    {
+        addToDeferredQueue(vertices, vertexCount, type, states);
+        return;
+    }
+
+    // This doesn't matter when recording, since the recorded draws are replayed from a vertex buffer
+    if (m_recording || (m_batch.enabled && !fboAttachment))
+    {
+        addToBatch(vertices, vertexCount, type, states);
+        return;
+    }
+
+    flushBatch();
+    drawVertices(vertices, vertexCount, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
+{
+    // Sanity check
+    if (firstVertex > vertexBuffer.getVertexCount())
+        return;
+
+    // Clamp vertexCount to something that makes sense
+    vertexCount = std::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
+
+    drawVertexBuffer(vertexBuffer, nullptr, firstVertex, vertexCount, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const IndexBuffer& indexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, indexBuffer, 0, indexBuffer.getIndexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states)
+{
+    // Sanity check
+    if (firstIndex > indexBuffer.getIndexCount())
+        return;
+
+    // Clamp indexCount to something that makes sense
+    indexCount = std::min(indexCount, indexBuffer.getIndexCount() - firstIndex);
+
+    // Nothing to draw?
+    if (!indexBuffer.getNativeHandle())
+        return;
+
+    drawVertexBuffer(vertexBuffer, &indexBuffer, firstIndex, indexCount, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstanced(const VertexBuffer&   vertexBuffer,
+                                 const InstanceBuffer& instanceBuffer,
+                                 const RenderStates&   states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Nothing to draw?
+    if (!vertexBuffer.getVertexCount() || !vertexBuffer.getNativeHandle() || !instanceBuffer.getInstanceCount())
+        return;
+
+    flushBatch();
+
+    if (m_recording)
+    {
+        m_recording->recordBuffer(vertexBuffer, nullptr, &instanceBuffer, 0, 0, states);
+        return;
+    }
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        // The backend is only selected once the GL states are set
+        if (!m_cache.glStatesSet)
+            resetGLStates();
+
+        // A user shader doesn't know about the instance attributes, so the instances are expanded on the CPU
+        // The built-in instancing shader relies on the fixed-function matrices, which the core backend doesn't set
+        const bool useHardwareInstancing = !states.shader && !m_cache.coreBackend && instanceBuffer.getNativeHandle() &&
+                                           InstanceBuffer::isAvailable() && loadInstancingProgram();
+
+        if (useHardwareInstancing)
+            drawInstancedPrimitives(vertexBuffer, instanceBuffer, states);
+        else
+            expandInstances(vertexBuffer, instanceBuffer, states);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isSrgb() const
+{
+    // By default sRGB encoding is not enabled for an arbitrary RenderTarget
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawVertices(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Check if the vertex count is low enough so that we can pre-transform them
@@ -360,17 +716,27 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
         if (useVertexCache)
         {
             // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                Vertex& vertex   = m_cache.vertexCache[i];
-                vertex.position  = states.transform * vertices[i].position;
-                vertex.color     = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
-            }
+            priv::transformVertices(states.transform, vertices, m_cache.vertexCache.data(), vertexCount);
+
+            if constexpr (RenderTargetImpl::statisticsEnabled)
+                ++getFrameStatistics().vertexCacheHits;
         }
 
         setupDraw(useVertexCache, states);
 
+        if (m_cache.coreBackend)
+        {
+            // Client memory can't be drawn from in core profile, the vertices are streamed into a buffer instead
+            m_coreBackend->bindVertices(useVertexCache ? m_cache.vertexCache.data() : vertices, vertexCount);
+
+            drawPrimitives(type, 0, vertexCount);
+            cleanupDraw(states);
+
+            // Update the cache
+            m_cache.useVertexCache = useVertexCache;
+            return;
+        }
+
         // Check if texture coordinates array is needed, and update client state accordingly
         const bool enableTexCoordsArray = (states.texture || states.shader);
         if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
@@ -414,71 +780,6 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
 }
 
 
-////////////////////////////////////////////////////////////
-void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
-{
-    draw(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
-}
-
-
-////////////////////////////////////////////////////////////
-void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
-{
-    // VertexBuffer not supported?
-    if (!VertexBuffer::isAvailable())
-    {
-        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
-        return;
-    }
-
-    // Sanity check
-    if (firstVertex > vertexBuffer.getVertexCount())
-        return;
-
-    // Clamp vertexCount to something that makes sense
-    vertexCount = std::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
-
-    // Nothing to draw?
-    if (!vertexCount || !vertexBuffer.getNativeHandle())
-        return;
-
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
-    {
-        setupDraw(false, states);
-
-        // Bind vertex buffer
-        VertexBuffer::bind(&vertexBuffer);
-
-        // Always enable texture coordinates
-        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
-            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-
-        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
-        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
-        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
-
-        drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
-
-        // Unbind vertex buffer
-        VertexBuffer::bind(nullptr);
-
-        cleanupDraw(states);
-
-        // Update the cache
-        m_cache.useVertexCache        = false;
-        m_cache.texCoordsArrayEnabled = true;
-    }
-}
-
-
-////////////////////////////////////////////////////////////
-bool RenderTarget::isSrgb() const
-{
-    // By default sRGB encoding is not enabled for an arbitrary RenderTarget
-    return false;
-}
-
-
 ////////////////////////////////////////////////////////////
 bool RenderTarget::setActive(bool active)
 {
@@ -520,30 +821,268 @@ bool RenderTarget::setActive(bool active)
 
 
 ////////////////////////////////////////////////////////////
-void RenderTarget::pushGLStates()
+void RenderTarget::setBatchingEnabled(bool enabled)
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
-    {
-#ifdef SFML_DEBUG
-        // make sure that the user didn't leave an unchecked OpenGL error
-        const GLenum error = glGetError();
-        if (error != GL_NO_ERROR)
-        {
-            err() << "OpenGL error (" << error << ") detected in user code, "
-                  << "you should check for errors with glGetError()" << std::endl;
-        }
-#endif
+    if (!enabled)
+        flushBatch();
 
+    m_batch.enabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isBatchingEnabled() const
+{
+    return m_batch.enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::flushBatch()
+{
+    // Deferred draws are sent to the batch, where the ones sorted next to each other are merged
+    if (!m_deferredQueue.entries.empty())
+        flushDeferredQueue();
+
+    if (m_batch.vertices.empty())
+        return;
+
+    // Recorded batches are kept by the command list instead of being drawn
+    if (m_recording)
+    {
+        m_recording->recordVertices(m_batch.vertices.data(), m_batch.vertices.size(), m_batch.type, m_batch.states);
+        m_batch.vertices.clear();
+        return;
+    }
+
+    // Swap the pending vertices out before drawing them, so that state
+    // changes happening while they are drawn don't try to flush them again
+    std::swap(m_batch.vertices, m_batch.flushedVertices);
+
+    drawVertices(m_batch.flushedVertices.data(), m_batch.flushedVertices.size(), m_batch.type, m_batch.states);
+    m_batch.flushedVertices.clear();
+
+    ++getFrameStatistics().flushedBatches;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setDeferredDrawingEnabled(bool enabled)
+{
+    // Draws issued before deferred drawing was enabled must not be sorted after the queued ones
+    flushBatch();
+
+    m_deferredQueue.enabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isDeferredDrawingEnabled() const
+{
+    return m_deferredQueue.enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setDrawLayer(int layer)
+{
+    m_deferredQueue.layer = layer;
+}
+
+
+////////////////////////////////////////////////////////////
+int RenderTarget::getDrawLayer() const
+{
+    return m_deferredQueue.layer;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::beginRecording(RenderCommandList& commandList)
+{
+    endRecording();
+    flushBatch();
+
+    commandList.clear();
+    m_recording = &commandList;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::endRecording()
+{
+    if (!m_recording)
+        return;
+
+    flushBatch();
+
+    m_recording->upload();
+    m_recording = nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isRecording() const
+{
+    return m_recording != nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderTarget::Statistics& RenderTarget::getStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::resetStatistics()
+{
+    m_statistics    = {};
+    m_frameFinished = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::beginProfileScope(std::string name)
+{
+    // Pending draws belong to the enclosing scope
+    flushBatch();
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        if (!m_profiler)
+            m_profiler = std::make_unique<priv::GpuProfiler>();
+
+        m_profiler->beginScope(std::move(name));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::endProfileScope()
+{
+    // Pending draws belong to the scope being closed
+    flushBatch();
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        if (!m_profiler || !m_profiler->endScope())
+            err() << "Failed to end profile scope, no scope was started with beginProfileScope" << std::endl;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<RenderTarget::ProfileResult> RenderTarget::getProfileResults()
+{
+    std::vector<ProfileResult> results;
+
+    if (m_profiler && (RenderTargetImpl::isActive(m_id) || setActive(true)))
+        m_profiler->collectResults(results);
+
+    return results;
+}
+
+
+////////////////////////////////////////////////////////////
+std::string RenderTarget::formatChromeTrace(const std::vector<ProfileResult>& results)
+{
+    std::ostringstream stream;
+    stream << "{\"traceEvents\":[";
+
+    // Complete events, GPU and CPU timings are shown as separate threads
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const ProfileResult& result = results[i];
+
+        stream << (i ? ",\n" : "\n") << "{\"name\":";
+        RenderTargetImpl::writeJsonString(stream, result.name);
+        stream << ",\"cat\":\"" << (result.gpuTime ? "gpu" : "cpu") << "\",\"ph\":\"X\""
+               << ",\"ts\":" << result.start.asMicroseconds() << ",\"dur\":" << result.duration.asMicroseconds()
+               << ",\"pid\":0,\"tid\":" << (result.gpuTime ? 0 : 1) << ",\"args\":{\"depth\":" << result.depth
+               << "}}";
+    }
+
+    stream << "\n]}\n";
+    return stream.str();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setVertexCacheSize(std::size_t size)
+{
+    m_cache.vertexCache.resize(size);
+    m_cache.vertexCache.shrink_to_fit();
+
+    // The cache storage may have moved, make sure the vertex pointers are set up again
+    m_cache.useVertexCache = false;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTarget::getVertexCacheSize() const
+{
+    return m_cache.vertexCache.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setBackend(Backend backend)
+{
+    flushBatch();
+
+    // The backend is selected when the GL states are set
+    m_backend           = backend;
+    m_cache.glStatesSet = false;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::Backend RenderTarget::getBackend() const
+{
+    return m_backend;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::Backend RenderTarget::getActiveBackend() const
+{
+    return m_cache.coreBackend ? Backend::Core : Backend::FixedFunction;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::pushGLStates()
+{
+    flushBatch();
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+#ifdef SFML_DEBUG
+        // make sure that the user didn't leave an unchecked OpenGL error
+        const GLenum error = glGetError();
+        if (error != GL_NO_ERROR)
+        {
+            err() << "OpenGL error (" << error << ") detected in user code, "
+                  << "you should check for errors with glGetError()" << std::endl;
+        }
+#endif
+
+        // There are no attribute and matrix stacks in core profile
+        if (!m_cache.coreBackend)
+        {
 #ifndef SFML_OPENGL_ES
-        glCheck(glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS));
-        glCheck(glPushAttrib(GL_ALL_ATTRIB_BITS));
+            glCheck(glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS));
+            glCheck(glPushAttrib(GL_ALL_ATTRIB_BITS));
 #endif
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glPushMatrix());
-        glCheck(glMatrixMode(GL_PROJECTION));
-        glCheck(glPushMatrix());
-        glCheck(glMatrixMode(GL_TEXTURE));
-        glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_PROJECTION));
+            glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_TEXTURE));
+            glCheck(glPushMatrix());
+        }
     }
 
     resetGLStates();
@@ -553,18 +1092,30 @@ void RenderTarget::pushGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::popGLStates()
 {
+    flushBatch();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
-        glCheck(glMatrixMode(GL_PROJECTION));
-        glCheck(glPopMatrix());
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glPopMatrix());
-        glCheck(glMatrixMode(GL_TEXTURE));
-        glCheck(glPopMatrix());
+        if (m_cache.coreBackend)
+        {
+            // Leave no vertex array object nor program bound for the user's OpenGL code,
+            // and set everything up again on the next draw since it may change any state
+            m_coreBackend->deactivate();
+            m_cache.enable = false;
+        }
+        else
+        {
+            glCheck(glMatrixMode(GL_PROJECTION));
+            glCheck(glPopMatrix());
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glPopMatrix());
+            glCheck(glMatrixMode(GL_TEXTURE));
+            glCheck(glPopMatrix());
 #ifndef SFML_OPENGL_ES
-        glCheck(glPopClientAttrib());
-        glCheck(glPopAttrib());
+            glCheck(glPopClientAttrib());
+            glCheck(glPopAttrib());
 #endif
+        }
     }
 }
 
@@ -572,6 +1123,8 @@ void RenderTarget::popGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::resetGLStates()
 {
+    flushBatch();
+
     // Check here to make sure a context change does not happen after activate(true)
     const bool shaderAvailable       = Shader::isAvailable();
     const bool vertexBufferAvailable = VertexBuffer::isAvailable();
@@ -590,8 +1143,20 @@ void RenderTarget::resetGLStates()
         // Make sure that extensions are initialized
         priv::ensureExtensionsInit();
 
+        // Select the pipeline the states are applied through, leaving the
+        // objects of the core backend unbound when switching away from it
+        const bool coreBackend = useCoreBackend();
+        if (m_cache.coreBackend && !coreBackend)
+            m_coreBackend->deactivate();
+
+        m_cache.coreBackend = coreBackend;
+
         // Make sure that the texture unit which is active is the number 0
-        if (GLEXT_multitexture)
+        if (m_cache.coreBackend)
+        {
+            glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
+        }
+        else if (GLEXT_multitexture)
         {
             glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
             glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
@@ -599,19 +1164,29 @@ void RenderTarget::resetGLStates()
 
         // Define the default OpenGL states
         glCheck(glDisable(GL_CULL_FACE));
-        glCheck(glDisable(GL_LIGHTING));
         glCheck(glDisable(GL_STENCIL_TEST));
         glCheck(glDisable(GL_DEPTH_TEST));
-        glCheck(glDisable(GL_ALPHA_TEST));
         glCheck(glDisable(GL_SCISSOR_TEST));
-        glCheck(glEnable(GL_TEXTURE_2D));
         glCheck(glEnable(GL_BLEND));
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glLoadIdentity());
-        glCheck(glEnableClientState(GL_VERTEX_ARRAY));
-        glCheck(glEnableClientState(GL_COLOR_ARRAY));
-        glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
         glCheck(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
+
+        if (m_cache.coreBackend)
+        {
+            // The built-in program of the core backend replaces the fixed-function states
+            m_coreBackend->activate();
+        }
+        else
+        {
+            glCheck(glDisable(GL_LIGHTING));
+            glCheck(glDisable(GL_ALPHA_TEST));
+            glCheck(glEnable(GL_TEXTURE_2D));
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glLoadIdentity());
+            glCheck(glEnableClientState(GL_VERTEX_ARRAY));
+            glCheck(glEnableClientState(GL_COLOR_ARRAY));
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+        }
+
         m_cache.scissorEnabled = false;
         m_cache.stencilEnabled = false;
         m_cache.glStatesSet    = true;
@@ -620,7 +1195,7 @@ void RenderTarget::resetGLStates()
         applyBlendMode(BlendAlpha);
         applyStencilMode(StencilMode());
         applyTexture(nullptr);
-        if (shaderAvailable)
+        if (shaderAvailable || m_cache.coreBackend)
             applyShader(nullptr);
 
         if (vertexBufferAvailable)
@@ -638,6 +1213,28 @@ void RenderTarget::resetGLStates()
 }
 
 
+////////////////////////////////////////////////////////////
+bool RenderTarget::useCoreBackend()
+{
+    if ((m_backend == Backend::FixedFunction) ||
+        ((m_backend == Backend::Automatic) && !priv::CoreRenderBackend::isCoreProfile()))
+        return false;
+
+    if (!priv::CoreRenderBackend::isAvailable())
+    {
+        err() << "The core rendering backend requires OpenGL 3.2, falling back to the fixed-function backend"
+              << std::endl;
+        return false;
+    }
+
+    if (!m_coreBackend)
+        m_coreBackend = std::make_unique<priv::CoreRenderBackend>();
+
+    // Compilation errors of the built-in program were already reported
+    return m_coreBackend->isLoaded();
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::initialize()
 {
@@ -654,6 +1251,30 @@ void RenderTarget::initialize()
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::finishFrame()
+{
+    flushBatch();
+
+    // Scopes left open can't be balanced anymore
+    if (m_profiler)
+        m_profiler->finishFrame();
+
+    // Keep the totals of the frame readable until the next one starts
+    m_frameFinished = true;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::Statistics& RenderTarget::getFrameStatistics()
+{
+    if (m_frameFinished)
+        resetStatistics();
+
+    return m_statistics;
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyCurrentView()
 {
@@ -685,13 +1306,23 @@ void RenderTarget::applyCurrentView()
     }
 
     // Set the projection matrix
-    glCheck(glMatrixMode(GL_PROJECTION));
-    glCheck(glLoadMatrixf(m_view.getTransform().getMatrix()));
+    if (m_cache.coreBackend)
+    {
+        m_coreBackend->setProjectionMatrix(m_view.getTransform().getMatrix());
+    }
+    else
+    {
+        glCheck(glMatrixMode(GL_PROJECTION));
+        glCheck(glLoadMatrixf(m_view.getTransform().getMatrix()));
 
-    // Go back to model-view mode
-    glCheck(glMatrixMode(GL_MODELVIEW));
+        // Go back to model-view mode
+        glCheck(glMatrixMode(GL_MODELVIEW));
+    }
 
     m_cache.viewChanged = false;
+
+    if constexpr (RenderTargetImpl::statisticsEnabled)
+        ++getFrameStatistics().viewChanges;
 }
 
 
@@ -745,6 +1376,9 @@ void RenderTarget::applyBlendMode(const BlendMode& mode)
     }
 
     m_cache.lastBlendMode = mode;
+
+    if constexpr (RenderTargetImpl::statisticsEnabled)
+        ++getFrameStatistics().blendModeChanges;
 }
 
 
@@ -782,12 +1416,24 @@ void RenderTarget::applyStencilMode(const StencilMode& mode)
     }
 
     m_cache.lastStencilMode = mode;
+
+    if constexpr (RenderTargetImpl::statisticsEnabled)
+        ++getFrameStatistics().stencilModeChanges;
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyTransform(const Transform& transform)
 {
+    if constexpr (RenderTargetImpl::statisticsEnabled)
+        ++getFrameStatistics().transformChanges;
+
+    if (m_cache.coreBackend)
+    {
+        m_coreBackend->setModelMatrix(transform.getMatrix());
+        return;
+    }
+
     // No need to call glMatrixMode(GL_MODELVIEW), it is always the
     // current mode (for optimization purpose, since it's the most used)
     if (transform == Transform::Identity)
@@ -800,17 +1446,503 @@ void RenderTarget::applyTransform(const Transform& transform)
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyTexture(const Texture* texture, CoordinateType coordinateType)
 {
-    Texture::bind(texture, coordinateType);
+    if (m_cache.coreBackend)
+    {
+        // The texture matrix is passed to the program instead of the fixed-function matrix stack
+        const bool textured = texture && texture->m_texture;
+        glCheck(glBindTexture(GL_TEXTURE_2D, textured ? texture->m_texture : 0));
+
+        if (textured)
+            m_coreBackend->setTexture(true, texture->getMatrix(coordinateType).data());
+        else
+            m_coreBackend->setTexture(false, Transform::Identity.getMatrix());
+    }
+    else
+    {
+        Texture::bind(texture, coordinateType);
+    }
 
     m_cache.lastTextureId      = texture ? texture->m_cacheId : 0;
     m_cache.lastCoordinateType = coordinateType;
+
+    if constexpr (RenderTargetImpl::statisticsEnabled)
+        ++getFrameStatistics().textureChanges;
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyShader(const Shader* shader)
 {
-    Shader::bind(shader);
+    if constexpr (RenderTargetImpl::statisticsEnabled)
+        ++getFrameStatistics().shaderChanges;
+
+    if (!m_cache.coreBackend)
+    {
+        Shader::bind(shader);
+        return;
+    }
+
+    // The user program is installed along with its textures, unbinding it
+    // means going back to the built-in program of the core backend
+    if (shader)
+        Shader::bind(shader);
+
+    m_coreBackend->setProgram(shader && Shader::isAvailable() ? shader->getNativeHandle() : 0);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawVertexBuffer(const VertexBuffer& vertexBuffer,
+                                    const IndexBuffer*  indexBuffer,
+                                    std::size_t         first,
+                                    std::size_t         count,
+                                    const RenderStates& states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Nothing to draw?
+    if (!count || !vertexBuffer.getNativeHandle())
+        return;
+
+    flushBatch();
+
+    if (m_recording)
+    {
+        m_recording->recordBuffer(vertexBuffer, indexBuffer, nullptr, first, count, states);
+        return;
+    }
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        setupDraw(false, states);
+
+        // Bind vertex buffer
+        VertexBuffer::bind(&vertexBuffer);
+
+        // Streaming buffers hold their vertices somewhere in their ring
+        const std::size_t base = sizeof(Vertex) * vertexBuffer.m_firstVertex;
+
+        if (m_cache.coreBackend)
+        {
+            m_coreBackend->bindVertexBuffer(base);
+        }
+        else
+        {
+            // Always enable texture coordinates
+            if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(base + 0)));
+            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(base + 8)));
+            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(base + 12)));
+        }
+
+        if (indexBuffer)
+            drawIndexedPrimitives(vertexBuffer.getPrimitiveType(), *indexBuffer, first, count);
+        else
+            drawPrimitives(vertexBuffer.getPrimitiveType(), first, count);
+
+        // Unbind vertex buffer
+        VertexBuffer::bind(nullptr);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache        = false;
+        m_cache.texCoordsArrayEnabled = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::loadInstancingProgram()
+{
+    if (m_instancingProgram)
+        return m_instancingProgram->loaded;
+
+    m_instancingProgram = std::make_unique<InstancingProgram>();
+    InstancingProgram& program = *m_instancingProgram;
+
+    if (!program.shader.loadFromMemory(RenderTargetImpl::instancingVertexShader,
+                                       RenderTargetImpl::instancingFragmentShader))
+    {
+        err() << "Failed to compile the instancing shader, instances will be expanded on the CPU" << std::endl;
+        return false;
+    }
+
+    program.shader.setUniform("sf_texture", Shader::CurrentTexture);
+
+    const unsigned int handle = program.shader.getNativeHandle();
+    const auto location = [handle](const char* name) { return glCheck(GLEXT_glGetAttribLocation(handle, name)); };
+
+    program.position            = location("sf_position");
+    program.color               = location("sf_color");
+    program.texCoords           = location("sf_texCoords");
+    program.instanceColumn0     = location("sf_instanceColumn0");
+    program.instanceColumn1     = location("sf_instanceColumn1");
+    program.instanceTranslation = location("sf_instanceTranslation");
+    program.instanceColor       = location("sf_instanceColor");
+    program.instanceTextureRect = location("sf_instanceTextureRect");
+    program.loaded              = true;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstancedPrimitives(const VertexBuffer&   vertexBuffer,
+                                           const InstanceBuffer& instanceBuffer,
+                                           const RenderStates&   states)
+{
+    using Instance = InstanceBuffer::Instance;
+
+    // The instance transform is stored as its two linear columns followed by its translation
+    constexpr std::size_t transformOffset = offsetof(Instance, transform);
+
+    InstancingProgram& program = *m_instancingProgram;
+    program.shader.setUniform("sf_textured", states.texture ? 1.f : 0.f);
+
+    RenderStates programStates = states;
+    programStates.shader       = &program.shader;
+
+    setupDraw(false, programStates);
+
+    // The built-in program only reads generic attributes, make sure no client array is fetched
+    glCheck(glDisableClientState(GL_VERTEX_ARRAY));
+    glCheck(glDisableClientState(GL_COLOR_ARRAY));
+    glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
+
+    const auto enableAttribute =
+        [](GLint location, GLint size, GLenum type, std::size_t stride, std::size_t offset, GLuint divisor)
+    {
+        // Attributes that the GLSL compiler optimized out have no location
+        if (location < 0)
+            return;
+
+        const auto      index      = static_cast<GLuint>(location);
+        const GLboolean normalized = (type == GL_UNSIGNED_BYTE) ? GL_TRUE : GL_FALSE;
+
+        glCheck(GLEXT_glEnableVertexAttribArray(index));
+        glCheck(GLEXT_glVertexAttribPointer(index,
+                                            size,
+                                            type,
+                                            normalized,
+                                            static_cast<GLsizei>(stride),
+                                            reinterpret_cast<const void*>(offset)));
+        glCheck(GLEXT_glVertexAttribDivisor(index, divisor));
+    };
+
+    // Per-vertex attributes
+    const std::size_t base = sizeof(Vertex) * vertexBuffer.m_firstVertex;
+    VertexBuffer::bind(&vertexBuffer);
+    enableAttribute(program.position, 2, GL_FLOAT, sizeof(Vertex), base + 0, 0);
+    enableAttribute(program.color, 4, GL_UNSIGNED_BYTE, sizeof(Vertex), base + 8, 0);
+    enableAttribute(program.texCoords, 2, GL_FLOAT, sizeof(Vertex), base + 12, 0);
+
+    // Per-instance attributes
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, instanceBuffer.getNativeHandle()));
+    const std::size_t column0Offset     = transformOffset;
+    const std::size_t column1Offset     = transformOffset + 2 * sizeof(float);
+    const std::size_t translationOffset = transformOffset + 4 * sizeof(float);
+    enableAttribute(program.instanceColumn0, 2, GL_FLOAT, sizeof(Instance), column0Offset, 1);
+    enableAttribute(program.instanceColumn1, 2, GL_FLOAT, sizeof(Instance), column1Offset, 1);
+    enableAttribute(program.instanceTranslation, 2, GL_FLOAT, sizeof(Instance), translationOffset, 1);
+    enableAttribute(program.instanceColor, 4, GL_UNSIGNED_BYTE, sizeof(Instance), offsetof(Instance, color), 1);
+    enableAttribute(program.instanceTextureRect, 4, GL_FLOAT, sizeof(Instance), offsetof(Instance, textureRect), 1);
+
+    glCheck(GLEXT_glDrawArraysInstanced(RenderTargetImpl::primitiveTypeToGlConstant(vertexBuffer.getPrimitiveType()),
+                                        0,
+                                        static_cast<GLsizei>(vertexBuffer.getVertexCount()),
+                                        static_cast<GLsizei>(instanceBuffer.getInstanceCount())));
+
+    if constexpr (RenderTargetImpl::statisticsEnabled)
+    {
+        Statistics& statistics = getFrameStatistics();
+        ++statistics.drawCalls;
+        statistics.vertices += vertexBuffer.getVertexCount() * instanceBuffer.getInstanceCount();
+    }
+
+    for (const GLint location : {program.position,
+                                 program.color,
+                                 program.texCoords,
+                                 program.instanceColumn0,
+                                 program.instanceColumn1,
+                                 program.instanceTranslation,
+                                 program.instanceColor,
+                                 program.instanceTextureRect})
+    {
+        if (location < 0)
+            continue;
+
+        glCheck(GLEXT_glVertexAttribDivisor(static_cast<GLuint>(location), 0));
+        glCheck(GLEXT_glDisableVertexAttribArray(static_cast<GLuint>(location)));
+    }
+
+    // Unbind vertex buffer
+    VertexBuffer::bind(nullptr);
+
+    // Restore the client arrays that every other draw relies on
+    glCheck(glEnableClientState(GL_VERTEX_ARRAY));
+    glCheck(glEnableClientState(GL_COLOR_ARRAY));
+
+    cleanupDraw(programStates);
+
+    // Update the cache, the array pointers must be set again by the next draw
+    m_cache.useVertexCache        = false;
+    m_cache.texCoordsArrayEnabled = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::expandInstances([[maybe_unused]] const VertexBuffer&   vertexBuffer,
+                                   [[maybe_unused]] const InstanceBuffer& instanceBuffer,
+                                   [[maybe_unused]] const RenderStates&   states)
+{
+#ifdef SFML_OPENGL_ES
+
+    // Vertex buffers can't be read back on OpenGL ES
+    err() << "Instanced drawing requires hardware instancing on OpenGL ES, drawing skipped" << std::endl;
+
+#else
+
+    const std::size_t vertexCount = vertexBuffer.getVertexCount();
+
+    // Read the mesh back from graphics memory
+    std::vector<Vertex>& mesh = m_batch.meshVertices;
+    mesh.resize(vertexCount);
+
+    // Streaming buffers hold their vertices somewhere in their ring, and may be persistently mapped
+    VertexBuffer::bind(&vertexBuffer);
+    glCheck(GLEXT_glGetBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                     static_cast<GLintptrARB>(sizeof(Vertex) * vertexBuffer.m_firstVertex),
+                                     static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                     mesh.data()));
+    VertexBuffer::bind(nullptr);
+
+    // Apply the attributes of every instance and let the batcher merge them into a single draw
+    // Textures attached to a framebuffer must be rebound on every draw, so they are never batched
+    const bool           fboAttachment    = states.texture && states.texture->m_fboAttachment;
+    std::vector<Vertex>& instanceVertices = m_batch.instanceVertices;
+    instanceVertices.resize(vertexCount);
+
+    for (const InstanceBuffer::Instance& instance : instanceBuffer.m_instances)
+    {
+        for (std::size_t i = 0; i < vertexCount; ++i)
+        {
+            instanceVertices[i].position  = mesh[i].position;
+            instanceVertices[i].color     = mesh[i].color * instance.color;
+            instanceVertices[i].texCoords = instance.textureRect.position +
+                                            mesh[i].texCoords.componentWiseMul(instance.textureRect.size);
+        }
+
+        RenderStates instanceStates = states;
+        instanceStates.transform *= instance.getTransform();
+
+        if (fboAttachment)
+            drawVertices(instanceVertices.data(), vertexCount, vertexBuffer.getPrimitiveType(), instanceStates);
+        else
+            addToBatch(instanceVertices.data(), vertexCount, vertexBuffer.getPrimitiveType(), instanceStates);
+    }
+
+    flushBatch();
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::addToBatch(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
+    const PrimitiveType batchType = RenderTargetImpl::getBatchPrimitiveType(type);
+
+    // Flush the pending batch if the new primitives can't be merged into it
+    if (!m_batch.vertices.empty() &&
+        ((batchType != m_batch.type) || !RenderTargetImpl::canShareBatch(states, m_batch.states)))
+        flushBatch();
+
+    Statistics& statistics = getFrameStatistics();
+    ++statistics.submittedDraws;
+    if (!m_batch.vertices.empty())
+        ++statistics.mergedDraws;
+
+    // Vertices are pre-transformed, so the batch itself is drawn with an identity transform
+    m_batch.type             = batchType;
+    m_batch.states           = states;
+    m_batch.states.transform = Transform::Identity;
+
+    std::vector<Vertex>& batch = m_batch.vertices;
+
+    // Lists can be transformed straight into the batch
+    if (type == batchType)
+    {
+        const std::size_t offset = batch.size();
+        batch.resize(offset + vertexCount);
+        priv::transformVertices(states.transform, vertices, batch.data() + offset, vertexCount);
+        return;
+    }
+
+    // Strips and fans are transformed first, then unrolled into lists
+    std::vector<Vertex>& transformed = m_batch.transformedVertices;
+    transformed.resize(vertexCount);
+    priv::transformVertices(states.transform, vertices, transformed.data(), vertexCount);
+
+    const auto append = [&batch, &transformed](std::size_t index) { batch.push_back(transformed[index]); };
+
+    switch (type)
+    {
+        case PrimitiveType::LineStrip:
+            for (std::size_t i = 1; i < vertexCount; ++i)
+            {
+                append(i - 1);
+                append(i);
+            }
+            break;
+        case PrimitiveType::TriangleStrip:
+            // Every other triangle of a strip has its winding reversed
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append((i % 2) ? i - 1 : i - 2);
+                append((i % 2) ? i - 2 : i - 1);
+                append(i);
+            }
+            break;
+        case PrimitiveType::TriangleFan:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append(0);
+                append(i - 1);
+                append(i);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::addToDeferredQueue(const Vertex*       vertices,
+                                      std::size_t         vertexCount,
+                                      PrimitiveType       type,
+                                      const RenderStates& states)
+{
+    DeferredQueue& queue = m_deferredQueue;
+
+    // Vertices are pre-transformed, so that the bounds of different draws can be compared
+    const std::size_t firstVertex = queue.vertices.size();
+    queue.vertices.resize(firstVertex + vertexCount);
+    Vertex* transformed = queue.vertices.data() + firstVertex;
+    priv::transformVertices(states.transform, vertices, transformed, vertexCount);
+
+    Vector2f minimum = transformed[0].position;
+    Vector2f maximum = transformed[0].position;
+    for (std::size_t i = 1; i < vertexCount; ++i)
+    {
+        minimum.x = std::min(minimum.x, transformed[i].position.x);
+        minimum.y = std::min(minimum.y, transformed[i].position.y);
+        maximum.x = std::max(maximum.x, transformed[i].position.x);
+        maximum.y = std::max(maximum.y, transformed[i].position.y);
+    }
+
+    // Points and lines are rasterized even though their bounds have no area, give them some thickness
+    if (RenderTargetImpl::getBatchPrimitiveType(type) != PrimitiveType::Triangles)
+    {
+        minimum -= Vector2f(1, 1);
+        maximum += Vector2f(1, 1);
+    }
+
+    const FloatRect bounds(minimum, maximum - minimum);
+
+    // Draws that can share a batch get the same states index, so that they are sorted next to each other
+    RenderStates entryStates = states;
+    entryStates.transform    = Transform::Identity;
+
+    const auto [found, inserted] = queue.statesIndices.try_emplace(entryStates, queue.states.size());
+    const std::size_t statesIndex = found->second;
+    if (inserted)
+        queue.states.push_back(entryStates);
+
+    // The draw must stay after every earlier draw of its layer that it overlaps, unless they share the same states:
+    // draws with the same slot and states keep their submission order when sorted
+    std::size_t slot       = 0;
+    const auto  updateSlot = [&](std::size_t index)
+    {
+        const DeferredQueue::Entry& entry = queue.entries[index];
+        if ((entry.layer == queue.layer) && RenderTargetImpl::boundsOverlap(entry.bounds, bounds))
+            slot = std::max(slot, (entry.statesIndex == statesIndex) ? entry.slot : entry.slot + 1);
+    };
+
+    // Only the draws sharing a grid cell with this one can overlap it, large draws are checked against all of them
+    const std::size_t index = queue.entries.size();
+    Vector2i          firstCell;
+    Vector2i          lastCell;
+
+    if (RenderTargetImpl::getDeferredCells(bounds, firstCell, lastCell))
+    {
+        for (const std::size_t largeIndex : queue.largeEntries)
+            updateSlot(largeIndex);
+
+        for (int y = firstCell.y; y <= lastCell.y; ++y)
+        {
+            for (int x = firstCell.x; x <= lastCell.x; ++x)
+            {
+                std::vector<std::size_t>& cell = queue.cells[{queue.layer, {x, y}}];
+                for (const std::size_t cellIndex : cell)
+                    updateSlot(cellIndex);
+
+                cell.push_back(index);
+            }
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < index; ++i)
+            updateSlot(i);
+
+        queue.largeEntries.push_back(index);
+    }
+
+    queue.entries.push_back({queue.layer, slot, statesIndex, firstVertex, vertexCount, type, bounds});
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::flushDeferredQueue()
+{
+    DeferredQueue& queue = m_deferredQueue;
+
+    // Swap the queue out before flushing it, so that the batch doesn't try to flush it again
+    std::swap(queue.entries, queue.flushedEntries);
+    std::swap(queue.vertices, queue.flushedVertices);
+    std::swap(queue.states, queue.flushedStates);
+    queue.statesIndices.clear();
+    queue.cells.clear();
+    queue.largeEntries.clear();
+
+    std::stable_sort(queue.flushedEntries.begin(),
+                     queue.flushedEntries.end(),
+                     [](const DeferredQueue::Entry& left, const DeferredQueue::Entry& right)
+                     {
+                         return std::tie(left.layer, left.slot, left.statesIndex) <
+                                std::tie(right.layer, right.slot, right.statesIndex);
+                     });
+
+    for (const DeferredQueue::Entry& entry : queue.flushedEntries)
+    {
+        addToBatch(queue.flushedVertices.data() + entry.firstVertex,
+                   entry.vertexCount,
+                   entry.type,
+                   queue.flushedStates[entry.statesIndex]);
+    }
+
+    queue.flushedEntries.clear();
+    queue.flushedVertices.clear();
+    queue.flushedStates.clear();
 }
 
 
@@ -835,11 +1967,15 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
     if (!m_cache.glStatesSet)
         resetGLStates();
 
+    // Another render target may have bound its own vertex array object and program
+    if (m_cache.coreBackend && !m_cache.enable)
+        m_coreBackend->activate();
+
     if (useVertexCache)
     {
         // Since vertices are transformed, we must use an identity transform to render them
         if (!m_cache.enable || !m_cache.useVertexCache)
-            glCheck(glLoadIdentity());
+            applyTransform(Transform::Identity);
     }
     else
     {
@@ -889,13 +2025,44 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 ////////////////////////////////////////////////////////////
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
-    // Find the OpenGL primitive type
-    static constexpr priv::EnumArray<PrimitiveType, GLenum, 6> modes =
-        {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
-    const GLenum mode = modes[type];
-
     // Draw the primitives
-    glCheck(glDrawArrays(mode, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
+    glCheck(glDrawArrays(RenderTargetImpl::primitiveTypeToGlConstant(type),
+                         static_cast<GLint>(firstVertex),
+                         static_cast<GLsizei>(vertexCount)));
+
+    if constexpr (RenderTargetImpl::statisticsEnabled)
+    {
+        Statistics& statistics = getFrameStatistics();
+        ++statistics.drawCalls;
+        statistics.vertices += vertexCount;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedPrimitives(PrimitiveType      type,
+                                         const IndexBuffer& indexBuffer,
+                                         std::size_t        firstIndex,
+                                         std::size_t        indexCount)
+{
+    const bool        useUInt32 = (indexBuffer.getType() == IndexBuffer::Type::UInt32);
+    const GLenum      indexType = useUInt32 ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+    const std::size_t indexSize = useUInt32 ? sizeof(std::uint32_t) : sizeof(std::uint16_t);
+
+    // Draw the primitives, the offset is relative to the bound index buffer
+    IndexBuffer::bind(&indexBuffer);
+    glCheck(glDrawElements(RenderTargetImpl::primitiveTypeToGlConstant(type),
+                           static_cast<GLsizei>(indexCount),
+                           indexType,
+                           reinterpret_cast<const void*>(firstIndex * indexSize)));
+    IndexBuffer::bind(nullptr);
+
+    if constexpr (RenderTargetImpl::statisticsEnabled)
+    {
+        Statistics& statistics = getFrameStatistics();
+        ++statistics.drawCalls;
+        statistics.vertices += indexCount;
+    }
 }
 
 
@@ -950,6 +2117,13 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 //   a new texture instance. We need to use our own unique
 //   identifier system to ensure consistent caching.
 //
+// * Batching
+//   When enabled, consecutive draws of vertex arrays sharing
+//   the same texture, shader, blend mode and stencil mode are
+//   pre-transformed and gathered into a single buffer, which
+//   is only drawn once these states change. This removes most
+//   of the per-draw overhead of sprites, shapes and texts.
+//
 // * Shader
 //   Shaders are very hard to optimize, because they have
 //   parameters that can be hard (if not impossible) to track,
@@ -155,6 +155,10 @@ bool RenderTexture::generateMipmap()
 ////////////////////////////////////////////////////////////
 bool RenderTexture::setActive(bool active)
 {
+    // Pending draws must be rendered while the render texture is still active
+    if (!active)
+        flushBatch();
+
     // Update RenderTarget tracking
     if (m_impl && m_impl->activate(active))
         return RenderTarget::setActive(active);
@@ -169,6 +173,8 @@ void RenderTexture::display()
     if (!m_impl)
         return;
 
+    finishFrame();
+
     if (priv::RenderTextureImplFBO::isAvailable())
     {
         // Perform a RenderTarget-only activation if we are using FBOs
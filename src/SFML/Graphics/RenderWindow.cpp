@@ -84,6 +84,10 @@ bool RenderWindow::isSrgb() const
 ////////////////////////////////////////////////////////////
 bool RenderWindow::setActive(bool active)
 {
+    // Pending draws must be rendered while the window is still active
+    if (!active)
+        flushBatch();
+
     bool result = Window::setActive(active);
 
     // Update RenderTarget tracking
@@ -125,4 +129,11 @@ void RenderWindow::onResize()
     setView(getView());
 }
 
+
+////////////////////////////////////////////////////////////
+void RenderWindow::onDisplay()
+{
+    finishFrame();
+}
+
 } // namespace sf
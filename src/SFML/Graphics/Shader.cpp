@@ -30,6 +30,7 @@
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
 
 #include <SFML/Window/GlResource.hpp>
 
@@ -40,14 +41,23 @@
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Vector3.hpp>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
+#include <mutex>
 #include <ostream>
+#include <random>
+#include <sstream>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include <cstdint>
+#include <cstring>
 
 #ifndef SFML_OPENGL_ES
 
@@ -65,6 +75,14 @@
 
 namespace
 {
+// Thread-safe unique identifier generator, recognizes the uniform handles of a program even if OpenGL reuses its name
+std::uint64_t getUniqueProgramId() noexcept
+{
+    static std::atomic<std::uint64_t> id(1); // start at 1, zero is "no program"
+
+    return id.fetch_add(1);
+}
+
 // Retrieve the maximum number of texture units available
 std::size_t getMaxTextureUnits()
 {
@@ -79,6 +97,223 @@ std::size_t getMaxTextureUnits()
     return static_cast<std::size_t>(maxUnits);
 }
 
+// Retrieve the maximum number of uniform buffer binding points available
+GLuint getMaxUniformBufferBindings()
+{
+    static const GLint maxBindings = []
+    {
+        GLint value = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS, &value));
+
+        return value;
+    }();
+
+    return static_cast<GLuint>(maxBindings);
+}
+
+// Settings and statistics of the program binary cache, shared by all shaders
+struct BinaryCache
+{
+    std::mutex                        mutex;
+    std::filesystem::path             directory;
+    sf::Shader::BinaryCacheStatistics statistics;
+};
+
+BinaryCache& getBinaryCache()
+{
+    static BinaryCache cache;
+    return cache;
+}
+
+// Signature at the start of the program binary files
+constexpr std::array<char, 8> binarySignature{'S', 'F', 'S', 'H', 'B', 'I', 'N', '\0'};
+
+// Feed a string into a 64-bit FNV-1a hash
+std::uint64_t hashString(std::uint64_t hash, std::string_view string)
+{
+    for (const char character : string)
+    {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 1099511628211u;
+    }
+
+    // Separate consecutive strings so that moving characters across them changes the hash
+    hash ^= 0xFFu;
+    hash *= 1099511628211u;
+
+    return hash;
+}
+
+// Identity of the sources of a program, stored in its cache file to reject binaries of colliding file names
+struct ProgramSourceKey
+{
+    std::uint64_t hash{};
+    std::uint64_t length{};
+};
+
+ProgramSourceKey getProgramSourceKey(std::string_view vertexShaderCode,
+                                     std::string_view geometryShaderCode,
+                                     std::string_view fragmentShaderCode)
+{
+    ProgramSourceKey key;
+    key.hash   = 14695981039346656037u;
+    key.hash   = hashString(key.hash, vertexShaderCode);
+    key.hash   = hashString(key.hash, geometryShaderCode);
+    key.hash   = hashString(key.hash, fragmentShaderCode);
+    key.length = vertexShaderCode.size() + geometryShaderCode.size() + fragmentShaderCode.size();
+    return key;
+}
+
+// Get an OpenGL string, or an empty string if it isn't available
+std::string_view getGlString(GLenum name)
+{
+    const auto* string = reinterpret_cast<const char*>(glCheck(glGetString(name)));
+    return string ? string : "";
+}
+
+// Get the path of the cache file of a program, or an empty path if the cache is disabled or not supported
+std::filesystem::path getProgramBinaryPath(const ProgramSourceKey& sourceKey)
+{
+    static const bool supported = []
+    {
+        if (!GLEXT_get_program_binary)
+            return false;
+
+        GLint formats = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS, &formats));
+        return formats > 0;
+    }();
+
+    std::filesystem::path directory;
+    {
+        BinaryCache&          cache = getBinaryCache();
+        const std::lock_guard guard(cache.mutex);
+        directory = cache.directory;
+    }
+
+    if (directory.empty() || !supported)
+        return {};
+
+    // Binaries only stay valid for the same sources and the same driver
+    std::uint64_t hash = sourceKey.hash;
+    hash               = hashString(hash, getGlString(GL_VENDOR));
+    hash               = hashString(hash, getGlString(GL_RENDERER));
+    hash               = hashString(hash, getGlString(GL_VERSION));
+
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << hash << ".bin";
+    return directory / name.str();
+}
+
+// Create a program from a cached binary, return a null handle if it is missing, belongs to
+// other sources or is rejected by the driver
+GLEXT_GLhandle loadProgramBinary(const std::filesystem::path& path, const ProgramSourceKey& sourceKey)
+{
+    auto file = std::ifstream(path, std::ios_base::binary);
+    if (!file)
+        return {};
+
+    const std::vector<char> contents{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+    ProgramSourceKey  storedKey;
+    GLenum            format     = 0;
+    const std::size_t headerSize = binarySignature.size() + sizeof(storedKey.hash) + sizeof(storedKey.length) +
+                                   sizeof(format);
+    if ((contents.size() <= headerSize) || !std::equal(binarySignature.begin(), binarySignature.end(), contents.begin()))
+        return {};
+
+    const char* header = contents.data() + binarySignature.size();
+    std::memcpy(&storedKey.hash, header, sizeof(storedKey.hash));
+    header += sizeof(storedKey.hash);
+    std::memcpy(&storedKey.length, header, sizeof(storedKey.length));
+    header += sizeof(storedKey.length);
+    std::memcpy(&format, header, sizeof(format));
+
+    // Two different sources can end up with the same file name, don't run the program of the other ones
+    if ((storedKey.hash != sourceKey.hash) || (storedKey.length != sourceKey.length))
+        return {};
+
+    const GLEXT_GLhandle program = glCheck(GLEXT_glCreateProgramObject());
+    glCheck(GLEXT_glProgramBinary(castFromGlHandle(program),
+                                  format,
+                                  contents.data() + headerSize,
+                                  static_cast<GLsizei>(contents.size() - headerSize)));
+
+    // The driver may reject binaries, for instance after an update
+    GLint success = GL_FALSE;
+    glCheck(GLEXT_glGetProgramiv(castFromGlHandle(program), GLEXT_GL_LINK_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        glCheck(GLEXT_glDeleteObject(program));
+        return {};
+    }
+
+    return program;
+}
+
+// Get a name for the temporary file of a cache entry, that no other thread or process writes to
+std::filesystem::path getTemporaryBinaryPath(const std::filesystem::path& path)
+{
+    static const std::uint64_t processToken = []
+    {
+        std::random_device device;
+        return (std::uint64_t{device()} << 32) | device();
+    }();
+    static std::atomic<std::uint64_t> counter(0);
+
+    std::ostringstream suffix;
+    suffix << '.' << std::hex << processToken << '-' << counter.fetch_add(1) << ".tmp";
+
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += suffix.str();
+    return temporaryPath;
+}
+
+// Write the binary of a linked program to the cache
+bool saveProgramBinary(GLEXT_GLhandle program, const std::filesystem::path& path, const ProgramSourceKey& sourceKey)
+{
+    GLint length = 0;
+    glCheck(GLEXT_glGetProgramiv(castFromGlHandle(program), GLEXT_GL_PROGRAM_BINARY_LENGTH, &length));
+    if (length <= 0)
+        return false;
+
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLsizei           written = 0;
+    GLenum            format  = 0;
+    glCheck(GLEXT_glGetProgramBinary(castFromGlHandle(program), length, &written, &format, binary.data()));
+    if (written <= 0)
+        return false;
+
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+
+    // Write to a temporary file first, so that a partially written binary is never loaded
+    const std::filesystem::path temporaryPath = getTemporaryBinaryPath(path);
+
+    bool success = false;
+    {
+        auto file = std::ofstream(temporaryPath, std::ios_base::binary | std::ios_base::trunc);
+        file.write(binarySignature.data(), static_cast<std::streamsize>(binarySignature.size()));
+        file.write(reinterpret_cast<const char*>(&sourceKey.hash), sizeof(sourceKey.hash));
+        file.write(reinterpret_cast<const char*>(&sourceKey.length), sizeof(sourceKey.length));
+        file.write(reinterpret_cast<const char*>(&format), sizeof(format));
+        file.write(binary.data(), written);
+        success = static_cast<bool>(file);
+    }
+
+    if (success)
+    {
+        std::filesystem::rename(temporaryPath, path, error);
+        success = !error;
+    }
+
+    // Don't leave partial or orphaned files behind in the cache directory
+    if (!success)
+        std::filesystem::remove(temporaryPath, error);
+
+    return success;
+}
+
 // Read the contents of a file into an array of char
 bool getFileContents(const std::filesystem::path& filename, std::vector<char>& buffer)
 {
@@ -168,6 +403,17 @@ std::vector<float> flatten(const sf::Glsl::Vec4* vectorArray, std::size_t length
 
     return contiguous;
 }
+
+// Replace stored uniform components, return whether they changed
+template <typename T>
+bool assignComponents(std::vector<T>& components, const T* values, std::size_t size)
+{
+    if ((components.size() == size) && std::equal(values, values + size, components.begin()))
+        return false;
+
+    components.assign(values, values + size);
+    return true;
+}
 } // namespace
 
 
@@ -180,17 +426,20 @@ struct Shader::UniformBinder
     /// \brief Constructor: set up state before uniform is set
     ///
     ////////////////////////////////////////////////////////////
-    UniformBinder(Shader& shader, const std::string& name) : currentProgram(castToGlHandle(shader.m_shaderProgram))
+    UniformBinder(const Shader& shader, UniformHandle handle) :
+    currentProgram(castToGlHandle(shader.m_shaderProgram)),
+    location(shader.getUniformLocation(handle))
     {
+        // Nothing to set if the uniform doesn't belong to the program
+        if (location == -1)
+            currentProgram = {};
+
         if (currentProgram)
         {
             // Enable program object
             savedProgram = glCheck(GLEXT_glGetHandle(GLEXT_GL_PROGRAM_OBJECT));
             if (currentProgram != savedProgram)
                 glCheck(GLEXT_glUseProgramObject(currentProgram));
-
-            // Store uniform location for further use outside constructor
-            location = shader.getUniformLocation(name);
         }
     }
 
@@ -220,7 +469,7 @@ struct Shader::UniformBinder
     TransientContextLock lock;           //!< Lock to keep context active while uniform is bound
     GLEXT_GLhandle       savedProgram{}; //!< Handle to the previously active program object
     GLEXT_GLhandle       currentProgram; //!< Handle to the program object of the modified sf::Shader instance
-    GLint                location{-1};   //!< Uniform location, used by the surrounding sf::Shader code
+    GLint                location;       //!< Uniform location, used by the surrounding sf::Shader code
 };
 
 
@@ -311,9 +560,14 @@ Shader::~Shader()
 ////////////////////////////////////////////////////////////
 Shader::Shader(Shader&& source) noexcept :
 m_shaderProgram(std::exchange(source.m_shaderProgram, 0u)),
+m_programId(std::exchange(source.m_programId, 0)),
 m_currentTexture(std::exchange(source.m_currentTexture, -1)),
 m_textures(std::move(source.m_textures)),
-m_uniforms(std::move(source.m_uniforms))
+m_uniforms(std::move(source.m_uniforms)),
+m_uniformBlocks(std::move(source.m_uniformBlocks)),
+m_uploadDeferred(std::exchange(source.m_uploadDeferred, false)),
+m_deferredUniforms(std::move(source.m_deferredUniforms)),
+m_dirtyUniforms(std::move(source.m_dirtyUniforms))
 {
 }
 
@@ -334,10 +588,15 @@ Shader& Shader::operator=(Shader&& right) noexcept
     }
 
     // Move the contents of right.
-    m_shaderProgram  = std::exchange(right.m_shaderProgram, 0u);
-    m_currentTexture = std::exchange(right.m_currentTexture, -1);
-    m_textures       = std::move(right.m_textures);
-    m_uniforms       = std::move(right.m_uniforms);
+    m_shaderProgram    = std::exchange(right.m_shaderProgram, 0u);
+    m_programId        = std::exchange(right.m_programId, 0);
+    m_currentTexture   = std::exchange(right.m_currentTexture, -1);
+    m_textures         = std::move(right.m_textures);
+    m_uniforms         = std::move(right.m_uniforms);
+    m_uniformBlocks    = std::move(right.m_uniformBlocks);
+    m_uploadDeferred   = std::exchange(right.m_uploadDeferred, false);
+    m_deferredUniforms = std::move(right.m_deferredUniforms);
+    m_dirtyUniforms    = std::move(right.m_dirtyUniforms);
     return *this;
 }
 
@@ -533,337 +792,678 @@ bool Shader::loadFromStream(InputStream& vertexShaderStream, InputStream& geomet
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, float x)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform1f(binder.location, x));
+    setUniform(findUniformHandle(name), x);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, Glsl::Vec2 v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform2f(binder.location, v.x, v.y));
+    setUniform(findUniformHandle(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Vec3& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform3f(binder.location, v.x, v.y, v.z));
+    setUniform(findUniformHandle(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Vec4& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform4f(binder.location, v.x, v.y, v.z, v.w));
+    setUniform(findUniformHandle(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, int x)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform1i(binder.location, x));
+    setUniform(findUniformHandle(name), x);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, Glsl::Ivec2 v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform2i(binder.location, v.x, v.y));
+    setUniform(findUniformHandle(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Ivec3& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform3i(binder.location, v.x, v.y, v.z));
+    setUniform(findUniformHandle(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Ivec4& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform4i(binder.location, v.x, v.y, v.z, v.w));
+    setUniform(findUniformHandle(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, bool x)
 {
-    setUniform(name, static_cast<int>(x));
+    setUniform(findUniformHandle(name), x);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, Glsl::Bvec2 v)
 {
-    setUniform(name, Glsl::Ivec2(v));
+    setUniform(findUniformHandle(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Bvec3& v)
 {
-    setUniform(name, Glsl::Ivec3(v));
+    setUniform(findUniformHandle(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Bvec4& v)
 {
-    setUniform(name, Glsl::Ivec4(v));
+    setUniform(findUniformHandle(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Mat3& matrix)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix3fv(binder.location, 1, GL_FALSE, matrix.array.data()));
+    setUniform(findUniformHandle(name), matrix);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Mat4& matrix)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix4fv(binder.location, 1, GL_FALSE, matrix.array.data()));
+    setUniform(findUniformHandle(name), matrix);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Texture& texture)
 {
-    if (!m_shaderProgram)
-        return;
-
-    const TransientContextLock lock;
-
-    // Find the location of the variable in the shader
-    const int location = getUniformLocation(name);
-    if (location != -1)
-    {
-        // Store the location -> texture mapping
-        const auto it = m_textures.find(location);
-        if (it == m_textures.end())
-        {
-            // New entry, make sure there are enough texture units
-            if (m_textures.size() + 1 >= getMaxTextureUnits())
-            {
-                err() << "Impossible to use texture " << std::quoted(name)
-                      << " for shader: all available texture units are used" << std::endl;
-                return;
-            }
-
-            m_textures[location] = &texture;
-        }
-        else
-        {
-            // Location already used, just replace the texture
-            it->second = &texture;
-        }
-    }
+    setUniform(findUniformHandle(name), texture);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, CurrentTextureType)
 {
-    if (!m_shaderProgram)
-        return;
-
-    const TransientContextLock lock;
-
-    // Find the location of the variable in the shader
-    m_currentTexture = getUniformLocation(name);
+    setUniform(findUniformHandle(name), CurrentTexture);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const float* scalarArray, std::size_t length)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform1fv(binder.location, static_cast<GLsizei>(length), scalarArray));
+    setUniformArray(findUniformHandle(name), scalarArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Vec2* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform2fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+    setUniformArray(findUniformHandle(name), vectorArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Vec3* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform3fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+    setUniformArray(findUniformHandle(name), vectorArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Vec4* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform4fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+    setUniformArray(findUniformHandle(name), vectorArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Mat3* matrixArray, std::size_t length)
 {
-    static const std::size_t matrixSize = matrixArray[0].array.size();
-
-    std::vector<float> contiguous(matrixSize * length);
-    for (std::size_t i = 0; i < length; ++i)
-        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix3fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+    setUniformArray(findUniformHandle(name), matrixArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length)
 {
-    static const std::size_t matrixSize = matrixArray[0].array.size();
+    setUniformArray(findUniformHandle(name), matrixArray, length);
+}
 
-    std::vector<float> contiguous(matrixSize * length);
-    for (std::size_t i = 0; i < length; ++i)
-        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
 
-    const UniformBinder binder(*this, name);
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, float x)
+{
+    if (m_uploadDeferred)
+    {
+        deferUniform(handle, UniformType::Float, &x, 1, 1);
+        return;
+    }
+
+    const UniformBinder binder(*this, handle);
     if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix4fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+        glCheck(GLEXT_glUniform1f(binder.location, x));
 }
 
 
 ////////////////////////////////////////////////////////////
-unsigned int Shader::getNativeHandle() const
+void Shader::setUniform(UniformHandle handle, Glsl::Vec2 v)
 {
-    return m_shaderProgram;
+    if (m_uploadDeferred)
+    {
+        const std::array values{v.x, v.y};
+        deferUniform(handle, UniformType::Vec2, values.data(), values.size(), 1);
+        return;
+    }
+
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform2f(binder.location, v.x, v.y));
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::bind(const Shader* shader)
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec3& v)
 {
-    const TransientContextLock lock;
-
-    // Make sure that we can use shaders
-    if (!isAvailable())
+    if (m_uploadDeferred)
     {
-        err() << "Failed to bind or unbind shader: your system doesn't support shaders "
-              << "(you should test Shader::isAvailable() before trying to use the Shader class)" << std::endl;
+        const std::array values{v.x, v.y, v.z};
+        deferUniform(handle, UniformType::Vec3, values.data(), values.size(), 1);
         return;
     }
 
-    if (shader && shader->m_shaderProgram)
-    {
-        // Enable the program
-        glCheck(GLEXT_glUseProgramObject(castToGlHandle(shader->m_shaderProgram)));
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform3f(binder.location, v.x, v.y, v.z));
+}
 
-        // Bind the textures
-        shader->bindTextures();
 
-        // Bind the current texture
-        if (shader->m_currentTexture != -1)
-            glCheck(GLEXT_glUniform1i(shader->m_currentTexture, 0));
-    }
-    else
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec4& v)
+{
+    if (m_uploadDeferred)
     {
-        // Bind no shader
-        glCheck(GLEXT_glUseProgramObject({}));
+        const std::array values{v.x, v.y, v.z, v.w};
+        deferUniform(handle, UniformType::Vec4, values.data(), values.size(), 1);
+        return;
     }
+
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform4f(binder.location, v.x, v.y, v.z, v.w));
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::isAvailable()
+void Shader::setUniform(UniformHandle handle, int x)
 {
-    static const bool available = []
+    if (m_uploadDeferred)
     {
-        const TransientContextLock contextLock;
-
-        // Make sure that extensions are initialized
-        priv::ensureExtensionsInit();
-
-        return GLEXT_multitexture && GLEXT_shading_language_100 && GLEXT_shader_objects && GLEXT_vertex_shader &&
-               GLEXT_fragment_shader;
-    }();
+        deferUniform(handle, UniformType::Int, &x, 1);
+        return;
+    }
 
-    return available;
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform1i(binder.location, x));
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::isGeometryAvailable()
+void Shader::setUniform(UniformHandle handle, Glsl::Ivec2 v)
 {
-    static const bool available = []
+    if (m_uploadDeferred)
     {
-        const TransientContextLock contextLock;
+        const std::array values{v.x, v.y};
+        deferUniform(handle, UniformType::Ivec2, values.data(), values.size());
+        return;
+    }
 
-        // Make sure that extensions are initialized
-        priv::ensureExtensionsInit();
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform2i(binder.location, v.x, v.y));
+}
 
-        return isAvailable() && (GLEXT_geometry_shader4 || GLEXT_GL_VERSION_3_2);
-    }();
 
-    return available;
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec3& v)
+{
+    if (m_uploadDeferred)
+    {
+        const std::array values{v.x, v.y, v.z};
+        deferUniform(handle, UniformType::Ivec3, values.data(), values.size());
+        return;
+    }
+
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform3i(binder.location, v.x, v.y, v.z));
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometryShaderCode, std::string_view fragmentShaderCode)
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec4& v)
 {
-    const TransientContextLock lock;
-
-    // First make sure that we can use shaders
-    if (!isAvailable())
+    if (m_uploadDeferred)
     {
-        err() << "Failed to create a shader: your system doesn't support shaders "
-              << "(you should test Shader::isAvailable() before trying to use the Shader class)" << std::endl;
-        return false;
+        const std::array values{v.x, v.y, v.z, v.w};
+        deferUniform(handle, UniformType::Ivec4, values.data(), values.size());
+        return;
     }
 
-    // Make sure we can use geometry shaders
-    if (!geometryShaderCode.empty() && !isGeometryAvailable())
-    {
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform4i(binder.location, v.x, v.y, v.z, v.w));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, bool x)
+{
+    setUniform(handle, static_cast<int>(x));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, Glsl::Bvec2 v)
+{
+    setUniform(handle, Glsl::Ivec2(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec3& v)
+{
+    setUniform(handle, Glsl::Ivec3(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec4& v)
+{
+    setUniform(handle, Glsl::Ivec4(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Mat3& matrix)
+{
+    if (m_uploadDeferred)
+    {
+        deferUniform(handle, UniformType::Mat3, matrix.array.data(), matrix.array.size(), 1);
+        return;
+    }
+
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniformMatrix3fv(binder.location, 1, GL_FALSE, matrix.array.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Mat4& matrix)
+{
+    if (m_uploadDeferred)
+    {
+        deferUniform(handle, UniformType::Mat4, matrix.array.data(), matrix.array.size(), 1);
+        return;
+    }
+
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniformMatrix4fv(binder.location, 1, GL_FALSE, matrix.array.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Texture& texture)
+{
+    if (!m_shaderProgram)
+        return;
+
+    const TransientContextLock lock;
+
+    // Find the location of the variable in the shader
+    const int location = getUniformLocation(handle);
+    if (location != -1)
+    {
+        // Store the location -> texture mapping
+        const auto it = m_textures.find(location);
+        if (it == m_textures.end())
+        {
+            // New entry, make sure there are enough texture units
+            if (m_textures.size() + 1 >= getMaxTextureUnits())
+            {
+                // Handles are always retrieved by name, so the name of the uniform is in the location cache
+                const auto uniform = std::find_if(m_uniforms.begin(),
+                                                  m_uniforms.end(),
+                                                  [location](const auto& entry) { return entry.second == location; });
+                err() << "Impossible to use texture " << std::quoted(uniform != m_uniforms.end() ? uniform->first : "")
+                      << " for shader: all available texture units are used" << std::endl;
+                return;
+            }
+
+            m_textures[location] = &texture;
+        }
+        else
+        {
+            // Location already used, just replace the texture
+            it->second = &texture;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, CurrentTextureType)
+{
+    if (!m_shaderProgram)
+        return;
+
+    // Find the location of the variable in the shader
+    m_currentTexture = getUniformLocation(handle);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const float* scalarArray, std::size_t length)
+{
+    if (m_uploadDeferred)
+    {
+        deferUniform(handle, UniformType::Float, scalarArray, length, length);
+        return;
+    }
+
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform1fv(binder.location, static_cast<GLsizei>(length), scalarArray));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Vec2* vectorArray, std::size_t length)
+{
+    std::vector<float> contiguous = flatten(vectorArray, length);
+
+    if (m_uploadDeferred)
+    {
+        deferUniform(handle, UniformType::Vec2, contiguous.data(), contiguous.size(), length);
+        return;
+    }
+
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform2fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Vec3* vectorArray, std::size_t length)
+{
+    std::vector<float> contiguous = flatten(vectorArray, length);
+
+    if (m_uploadDeferred)
+    {
+        deferUniform(handle, UniformType::Vec3, contiguous.data(), contiguous.size(), length);
+        return;
+    }
+
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform3fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Vec4* vectorArray, std::size_t length)
+{
+    std::vector<float> contiguous = flatten(vectorArray, length);
+
+    if (m_uploadDeferred)
+    {
+        deferUniform(handle, UniformType::Vec4, contiguous.data(), contiguous.size(), length);
+        return;
+    }
+
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform4fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Mat3* matrixArray, std::size_t length)
+{
+    static const std::size_t matrixSize = matrixArray[0].array.size();
+
+    std::vector<float> contiguous(matrixSize * length);
+    for (std::size_t i = 0; i < length; ++i)
+        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
+
+    if (m_uploadDeferred)
+    {
+        deferUniform(handle, UniformType::Mat3, contiguous.data(), contiguous.size(), length);
+        return;
+    }
+
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniformMatrix3fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Mat4* matrixArray, std::size_t length)
+{
+    static const std::size_t matrixSize = matrixArray[0].array.size();
+
+    std::vector<float> contiguous(matrixSize * length);
+    for (std::size_t i = 0; i < length; ++i)
+        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
+
+    if (m_uploadDeferred)
+    {
+        deferUniform(handle, UniformType::Mat4, contiguous.data(), contiguous.size(), length);
+        return;
+    }
+
+    const UniformBinder binder(*this, handle);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniformMatrix4fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Shader::getNativeHandle() const
+{
+    return m_shaderProgram;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::bind(const Shader* shader)
+{
+    const TransientContextLock lock;
+
+    // Make sure that we can use shaders
+    if (!isAvailable())
+    {
+        err() << "Failed to bind or unbind shader: your system doesn't support shaders "
+              << "(you should test Shader::isAvailable() before trying to use the Shader class)" << std::endl;
+        return;
+    }
+
+    if (shader && shader->m_shaderProgram)
+    {
+        // Enable the program
+        glCheck(GLEXT_glUseProgramObject(castToGlHandle(shader->m_shaderProgram)));
+
+        // Upload the uniforms that changed since the last bind
+        shader->uploadDeferredUniforms();
+
+        // Bind the textures
+        shader->bindTextures();
+
+        // Bind the uniform buffers
+        shader->bindUniformBlocks();
+
+        // Bind the current texture
+        if (shader->m_currentTexture != -1)
+            glCheck(GLEXT_glUniform1i(shader->m_currentTexture, 0));
+    }
+    else
+    {
+        // Bind no shader
+        glCheck(GLEXT_glUseProgramObject({}));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_multitexture && GLEXT_shading_language_100 && GLEXT_shader_objects && GLEXT_vertex_shader &&
+               GLEXT_fragment_shader;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isGeometryAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return isAvailable() && (GLEXT_geometry_shader4 || GLEXT_GL_VERSION_3_2);
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setBinaryCacheDirectory(const std::filesystem::path& directory)
+{
+    BinaryCache&          cache = getBinaryCache();
+    const std::lock_guard guard(cache.mutex);
+    cache.directory = directory;
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getBinaryCacheDirectory()
+{
+    BinaryCache&          cache = getBinaryCache();
+    const std::lock_guard guard(cache.mutex);
+    return cache.directory;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::BinaryCacheStatistics Shader::getBinaryCacheStatistics()
+{
+    BinaryCache&          cache = getBinaryCache();
+    const std::lock_guard guard(cache.mutex);
+    return cache.statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometryShaderCode, std::string_view fragmentShaderCode)
+{
+    const TransientContextLock lock;
+
+    // First make sure that we can use shaders
+    if (!isAvailable())
+    {
+        err() << "Failed to create a shader: your system doesn't support shaders "
+              << "(you should test Shader::isAvailable() before trying to use the Shader class)" << std::endl;
+        return false;
+    }
+
+    // Make sure we can use geometry shaders
+    if (!geometryShaderCode.empty() && !isGeometryAvailable())
+    {
         err() << "Failed to create a shader: your system doesn't support geometry shaders "
               << "(you should test Shader::isGeometryAvailable() before trying to use geometry shaders)" << std::endl;
         return false;
     }
 
+    // Helper function to replace the current program by a newly linked one
+    const auto installProgram = [this](GLEXT_GLhandle program)
+    {
+        // Destroy the shader if it was already created
+        if (m_shaderProgram)
+        {
+            glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
+            m_shaderProgram = 0;
+        }
+
+        // Reset the internal state
+        m_currentTexture = -1;
+        m_textures.clear();
+        m_uniforms.clear();
+        m_uniformBlocks.clear();
+        m_deferredUniforms.clear();
+        m_dirtyUniforms.clear();
+
+        m_shaderProgram = castFromGlHandle(program);
+        m_programId     = getUniqueProgramId();
+
+        // Force an OpenGL flush, so that the shader will appear updated
+        // in all contexts immediately (solves problems in multi-threaded apps)
+        glCheck(glFlush());
+    };
+
+    // Load the program from the binary cache if it has it
+    const ProgramSourceKey      sourceKey  = getProgramSourceKey(vertexShaderCode, geometryShaderCode, fragmentShaderCode);
+    const std::filesystem::path binaryPath = getProgramBinaryPath(sourceKey);
+    if (!binaryPath.empty())
+    {
+        const GLEXT_GLhandle cachedProgram = loadProgramBinary(binaryPath, sourceKey);
+
+        {
+            BinaryCache&          cache = getBinaryCache();
+            const std::lock_guard guard(cache.mutex);
+
+            if (cachedProgram)
+                ++cache.statistics.hits;
+            else
+                ++cache.statistics.misses;
+        }
+
+        if (cachedProgram)
+        {
+            installProgram(cachedProgram);
+            return true;
+        }
+    }
+
     // Create the program
     const GLEXT_GLhandle shaderProgram = glCheck(GLEXT_glCreateProgramObject());
 
@@ -912,58 +1512,167 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
         if (!createAndAttachShader(GLEXT_GL_FRAGMENT_SHADER, "fragment", fragmentShaderCode))
             return false;
 
+    // Ask the driver to keep the binary of the program so that it can be cached
+    if (!binaryPath.empty())
+        glCheck(GLEXT_glProgramParameteri(castFromGlHandle(shaderProgram), GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+
     // Link the program
     glCheck(GLEXT_glLinkProgram(shaderProgram));
 
-    // Check the link log
-    GLint success = 0;
-    glCheck(GLEXT_glGetObjectParameteriv(shaderProgram, GLEXT_GL_OBJECT_LINK_STATUS, &success));
-    if (success == GL_FALSE)
+    // Check the link log
+    GLint success = 0;
+    glCheck(GLEXT_glGetObjectParameteriv(shaderProgram, GLEXT_GL_OBJECT_LINK_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        std::array<char, 1024> log{};
+        glCheck(GLEXT_glGetInfoLog(shaderProgram, static_cast<GLsizei>(log.size()), nullptr, log.data()));
+        err() << "Failed to link shader:" << '\n' << log.data() << std::endl;
+        glCheck(GLEXT_glDeleteObject(shaderProgram));
+        return false;
+    }
+
+    // Store the program in the binary cache for the next launches
+    if (!binaryPath.empty())
+    {
+        if (saveProgramBinary(shaderProgram, binaryPath, sourceKey))
+        {
+            BinaryCache&          cache = getBinaryCache();
+            const std::lock_guard guard(cache.mutex);
+            ++cache.statistics.writes;
+        }
+        else
+        {
+            err() << "Failed to store shader binary in " << binaryPath << std::endl;
+        }
+    }
+
+    installProgram(shaderProgram);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::bindTextures() const
+{
+    auto it = m_textures.begin();
+    for (std::size_t i = 0; i < m_textures.size(); ++i)
+    {
+        const auto index = static_cast<GLsizei>(i + 1);
+        glCheck(GLEXT_glUniform1i(it->first, index));
+        glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0 + static_cast<GLenum>(index)));
+        Texture::bind(it->second);
+        ++it;
+    }
+
+    // Make sure that the texture unit which is left active is the number 0
+    glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+    for (const auto& [index, buffer] : m_uniformBlocks)
+        glCheck(GLEXT_glBindBufferBase(GLEXT_GL_UNIFORM_BUFFER, index, buffer->getNativeHandle()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformBlock(const std::string& name, const UniformBuffer& buffer)
+{
+    if (!m_shaderProgram)
+        return;
+
+    // Make sure that we can use uniform buffers
+    if (!UniformBuffer::isAvailable())
+    {
+        err() << "Failed to set uniform block " << std::quoted(name) << ": your system doesn't support uniform buffers "
+              << "(you should test UniformBuffer::isAvailable() before trying to use uniform blocks)" << std::endl;
+        return;
+    }
+
+    const TransientContextLock lock;
+
+    // Find the index of the block in the shader
+    const GLuint index = glCheck(GLEXT_glGetUniformBlockIndex(m_shaderProgram, name.c_str()));
+    if (index == GLEXT_GL_INVALID_INDEX)
+    {
+        err() << "Uniform block " << std::quoted(name) << " not found in shader" << std::endl;
+        return;
+    }
+
+    // The block uses the binding point matching its index, make sure it exists
+    if (index >= getMaxUniformBufferBindings())
     {
-        std::array<char, 1024> log{};
-        glCheck(GLEXT_glGetInfoLog(shaderProgram, static_cast<GLsizei>(log.size()), nullptr, log.data()));
-        err() << "Failed to link shader:" << '\n' << log.data() << std::endl;
-        glCheck(GLEXT_glDeleteObject(shaderProgram));
-        return false;
+        err() << "Impossible to use uniform block " << std::quoted(name)
+              << ": all available uniform buffer binding points are used" << std::endl;
+        return;
     }
 
-    // Destroy the shader if it was already created
-    if (m_shaderProgram)
+    // Store the index -> buffer mapping
+    const auto [it, inserted] = m_uniformBlocks.try_emplace(index, &buffer);
+    if (inserted)
+        glCheck(GLEXT_glUniformBlockBinding(m_shaderProgram, index, index));
+    else
+        it->second = &buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformUploadDeferred(bool deferred)
+{
+    if (deferred == m_uploadDeferred)
+        return;
+
+    // Send the pending values now, nothing would upload them otherwise
+    if (!deferred && m_shaderProgram && !m_dirtyUniforms.empty())
     {
-        glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
-        m_shaderProgram = 0;
+        const TransientContextLock lock;
+
+        const GLEXT_GLhandle savedProgram = glCheck(GLEXT_glGetHandle(GLEXT_GL_PROGRAM_OBJECT));
+        glCheck(GLEXT_glUseProgramObject(castToGlHandle(m_shaderProgram)));
+        uploadDeferredUniforms();
+        glCheck(GLEXT_glUseProgramObject(savedProgram));
     }
 
-    // Reset the internal state
-    m_currentTexture = -1;
-    m_textures.clear();
-    m_uniforms.clear();
+    m_deferredUniforms.clear();
+    m_dirtyUniforms.clear();
+    m_uploadDeferred = deferred;
+}
+
 
-    m_shaderProgram = castFromGlHandle(shaderProgram);
+////////////////////////////////////////////////////////////
+bool Shader::isUniformUploadDeferred() const
+{
+    return m_uploadDeferred;
+}
 
-    // Force an OpenGL flush, so that the shader will appear updated
-    // in all contexts immediately (solves problems in multi-threaded apps)
-    glCheck(glFlush());
 
-    return true;
+////////////////////////////////////////////////////////////
+Shader::UniformHandle Shader::getUniformHandle(std::string_view name)
+{
+    return findUniformHandle(std::string(name));
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::bindTextures() const
+Shader::UniformHandle Shader::findUniformHandle(const std::string& name)
 {
-    auto it = m_textures.begin();
-    for (std::size_t i = 0; i < m_textures.size(); ++i)
-    {
-        const auto index = static_cast<GLsizei>(i + 1);
-        glCheck(GLEXT_glUniform1i(it->first, index));
-        glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0 + static_cast<GLenum>(index)));
-        Texture::bind(it->second);
-        ++it;
-    }
+    if (!m_shaderProgram)
+        return {};
 
-    // Make sure that the texture unit which is left active is the number 0
-    glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
+    return {m_programId, getUniformLocation(name)};
+}
+
+
+////////////////////////////////////////////////////////////
+int Shader::getUniformLocation(UniformHandle handle) const
+{
+    // Handles retrieved from a previous program are ignored
+    if (!m_shaderProgram || (handle.m_program != m_programId))
+        return -1;
+
+    return handle.m_location;
 }
 
 
@@ -978,6 +1687,8 @@ int Shader::getUniformLocation(const std::string& name)
     }
 
     // Not in cache, request the location from OpenGL
+    const TransientContextLock lock;
+
     const int location = GLEXT_glGetUniformLocation(castToGlHandle(m_shaderProgram), name.c_str());
     m_uniforms.try_emplace(name, location);
 
@@ -987,6 +1698,107 @@ int Shader::getUniformLocation(const std::string& name)
     return location;
 }
 
+
+////////////////////////////////////////////////////////////
+void Shader::deferUniform(UniformHandle handle, UniformType type, const float* values, std::size_t size, std::size_t count)
+{
+    const int location = getUniformLocation(handle);
+    if ((location == -1) || (count == 0))
+        return;
+
+    DeferredUniform& uniform = m_deferredUniforms[location];
+
+    // Values identical to the stored ones don't need to be uploaded again
+    const bool changed = assignComponents(uniform.floats, values, size);
+    if (!changed && (uniform.type == type) && (uniform.count == count))
+        return;
+
+    uniform.type  = type;
+    uniform.count = count;
+
+    if (!uniform.dirty)
+    {
+        uniform.dirty = true;
+        m_dirtyUniforms.push_back(location);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::deferUniform(UniformHandle handle, UniformType type, const int* values, std::size_t size)
+{
+    const int location = getUniformLocation(handle);
+    if (location == -1)
+        return;
+
+    DeferredUniform& uniform = m_deferredUniforms[location];
+
+    // Values identical to the stored ones don't need to be uploaded again
+    const bool changed = assignComponents(uniform.ints, values, size);
+    if (!changed && (uniform.type == type) && (uniform.count == 1))
+        return;
+
+    uniform.type  = type;
+    uniform.count = 1;
+
+    if (!uniform.dirty)
+    {
+        uniform.dirty = true;
+        m_dirtyUniforms.push_back(location);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::uploadDeferredUniforms() const
+{
+    for (const int location : m_dirtyUniforms)
+    {
+        DeferredUniform& uniform = m_deferredUniforms[location];
+        const auto       count   = static_cast<GLsizei>(uniform.count);
+        const float*     floats  = uniform.floats.data();
+        const int*       ints    = uniform.ints.data();
+
+        switch (uniform.type)
+        {
+            case UniformType::Float:
+                glCheck(GLEXT_glUniform1fv(location, count, floats));
+                break;
+            case UniformType::Vec2:
+                glCheck(GLEXT_glUniform2fv(location, count, floats));
+                break;
+            case UniformType::Vec3:
+                glCheck(GLEXT_glUniform3fv(location, count, floats));
+                break;
+            case UniformType::Vec4:
+                glCheck(GLEXT_glUniform4fv(location, count, floats));
+                break;
+            case UniformType::Int:
+                glCheck(GLEXT_glUniform1i(location, ints[0]));
+                break;
+            case UniformType::Ivec2:
+                glCheck(GLEXT_glUniform2i(location, ints[0], ints[1]));
+                break;
+            case UniformType::Ivec3:
+                glCheck(GLEXT_glUniform3i(location, ints[0], ints[1], ints[2]));
+                break;
+            case UniformType::Ivec4:
+                glCheck(GLEXT_glUniform4i(location, ints[0], ints[1], ints[2], ints[3]));
+                break;
+            case UniformType::Mat3:
+                glCheck(GLEXT_glUniformMatrix3fv(location, count, GL_FALSE, floats));
+                break;
+            case UniformType::Mat4:
+                glCheck(GLEXT_glUniformMatrix4fv(location, count, GL_FALSE, floats));
+                break;
+        }
+
+        uniform.dirty = false;
+    }
+
+    m_dirtyUniforms.clear();
+}
+
 } // namespace sf
 
 #else // SFML_OPENGL_ES
@@ -1277,6 +2089,164 @@ void Shader::setUniformArray(const std::string& /* name */, const Glsl::Mat4* /*
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setUniformBlock(const std::string& /* name */, const UniformBuffer& /* buffer */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformUploadDeferred(bool /* deferred */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isUniformUploadDeferred() const
+{
+    return m_uploadDeferred;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::UniformHandle Shader::getUniformHandle(std::string_view /* name */)
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, float)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, Glsl::Vec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, int)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, Glsl::Ivec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, bool)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, Glsl::Bvec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Mat3& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Mat4& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Texture& /* texture */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, CurrentTextureType)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const float* /* scalarArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Vec2* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Vec3* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Vec4* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Mat3* /* matrixArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Mat4* /* matrixArray */, std::size_t /* length */)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
@@ -1304,6 +2274,26 @@ bool Shader::isGeometryAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setBinaryCacheDirectory(const std::filesystem::path& /* directory */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getBinaryCacheDirectory()
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::BinaryCacheStatistics Shader::getBinaryCacheStatistics()
+{
+    return {};
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Shader::compile(std::string_view /* vertexShaderCode */,
                      std::string_view /* geometryShaderCode */,
@@ -1318,6 +2308,34 @@ void Shader::bindTextures() const
 {
 }
 
+
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::deferUniform(UniformHandle /* handle */,
+                          UniformType /* type */,
+                          const float* /* values */,
+                          std::size_t /* size */,
+                          std::size_t /* count */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::deferUniform(UniformHandle /* handle */, UniformType /* type */, const int* /* values */, std::size_t /* size */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::uploadDeferredUniforms() const
+{
+}
+
 } // namespace sf
 
 #endif // SFML_OPENGL_ES
@@ -31,6 +31,7 @@
 #include <SFML/Graphics/Texture.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 
 #include <cmath>
@@ -61,15 +62,30 @@ void addLine(sf::VertexArray& vertices,
 }
 
 // Add a glyph quad to the vertex array
-void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, sf::Color color, const sf::Glyph& glyph, float italicShear)
+// The quad is padded by one unit, as long as it doesn't sample the texture beyond the padding of the glyph
+void addGlyphQuad(sf::VertexArray& vertices,
+                  sf::Vector2f     position,
+                  sf::Color        color,
+                  const sf::Glyph& glyph,
+                  float            italicShear,
+                  float            maxTexturePadding)
 {
-    const sf::Vector2f padding(1.f, 1.f);
+    // Distance field glyphs are scaled from their texture, one unit then covers several texels
+    sf::Vector2f texelsPerUnit(1.f, 1.f);
+    if ((glyph.bounds.size.x > 0) && (glyph.textureRect.size.x > 0))
+        texelsPerUnit.x = static_cast<float>(glyph.textureRect.size.x) / glyph.bounds.size.x;
+    if ((glyph.bounds.size.y > 0) && (glyph.textureRect.size.y > 0))
+        texelsPerUnit.y = static_cast<float>(glyph.textureRect.size.y) / glyph.bounds.size.y;
+
+    const sf::Vector2f texturePadding(std::min(texelsPerUnit.x, maxTexturePadding),
+                                      std::min(texelsPerUnit.y, maxTexturePadding));
+    const sf::Vector2f padding = texturePadding.componentWiseDiv(texelsPerUnit);
 
     const sf::Vector2f p1 = glyph.bounds.position - padding;
     const sf::Vector2f p2 = glyph.bounds.position + glyph.bounds.size + padding;
 
-    const auto uv1 = sf::Vector2f(glyph.textureRect.position) - padding;
-    const auto uv2 = sf::Vector2f(glyph.textureRect.position + glyph.textureRect.size) + padding;
+    const auto uv1 = sf::Vector2f(glyph.textureRect.position) - texturePadding;
+    const auto uv2 = sf::Vector2f(glyph.textureRect.position + glyph.textureRect.size) + texturePadding;
 
     vertices.append({position + sf::Vector2f(p1.x - italicShear * p1.y, p1.y), color, {uv1.x, uv1.y}});
     vertices.append({position + sf::Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
@@ -97,8 +113,47 @@ void Text::setString(const String& string)
 {
     if (m_string != string)
     {
-        m_string             = string;
-        m_geometryNeedUpdate = true;
+        // Find the part of the string that changed, the lines around it are the only ones to update
+        const std::size_t oldSize = m_string.getSize();
+        const std::size_t newSize = string.getSize();
+        const std::size_t minSize = std::min(oldSize, newSize);
+
+        std::size_t prefix = 0;
+        while ((prefix < minSize) && (m_string[prefix] == string[prefix]))
+            ++prefix;
+
+        std::size_t suffix = 0;
+        while ((suffix < minSize - prefix) && (m_string[oldSize - 1 - suffix] == string[newSize - 1 - suffix]))
+            ++suffix;
+
+        m_string = string;
+        recordStringEdit(prefix, oldSize - prefix - suffix, newSize - prefix - suffix);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::insertString(std::size_t position, const String& string)
+{
+    if (!string.isEmpty())
+    {
+        position = std::min(position, m_string.getSize());
+        m_string.insert(position, string);
+        recordStringEdit(position, 0, string.getSize());
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::eraseString(std::size_t position, std::size_t count)
+{
+    position = std::min(position, m_string.getSize());
+    count    = std::min(count, m_string.getSize() - position);
+
+    if (count > 0)
+    {
+        m_string.erase(position, count);
+        recordStringEdit(position, count, 0);
     }
 }
 
@@ -158,6 +213,28 @@ void Text::setStyle(std::uint32_t style)
 }
 
 
+////////////////////////////////////////////////////////////
+void Text::setMaxWidth(float maxWidth)
+{
+    if (m_maxWidth != maxWidth)
+    {
+        m_maxWidth           = maxWidth;
+        m_geometryNeedUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::setAlignment(Alignment alignment)
+{
+    if (m_alignment != alignment)
+    {
+        m_alignment          = alignment;
+        m_geometryNeedUpdate = true;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void Text::setFillColor(Color color)
 {
@@ -247,6 +324,20 @@ std::uint32_t Text::getStyle() const
 }
 
 
+////////////////////////////////////////////////////////////
+float Text::getMaxWidth() const
+{
+    return m_maxWidth;
+}
+
+
+////////////////////////////////////////////////////////////
+Text::Alignment Text::getAlignment() const
+{
+    return m_alignment;
+}
+
+
 ////////////////////////////////////////////////////////////
 Color Text::getFillColor() const
 {
@@ -274,6 +365,9 @@ Vector2f Text::findCharacterPos(std::size_t index) const
     // Adjust the index if it's out of range
     index = std::min(index, m_string.getSize());
 
+    // Lines may be wrapped and aligned, their layout is needed
+    ensureGeometryUpdate();
+
     // Precompute the variables needed by the algorithm
     const bool  isBold          = m_style & Bold;
     float       whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
@@ -281,10 +375,22 @@ Vector2f Text::findCharacterPos(std::size_t index) const
     whitespaceWidth += letterSpacing;
     const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
 
-    // Compute the position
-    Vector2f      position;
-    std::uint32_t prevChar = 0;
-    for (std::size_t i = 0; i < index; ++i)
+    // Find the line of the character
+    Vector2f    position;
+    std::size_t begin = 0;
+    std::size_t line  = 0;
+    while ((line + 1 < m_lines.size()) && (begin + m_lines[line].length <= index))
+    {
+        begin += m_lines[line++].length;
+        position.y += lineSpacing;
+    }
+
+    if (line < m_lines.size())
+        position.x = m_lines[line].offset;
+
+    // Compute the position within the line
+    std::uint32_t prevChar = (begin > 0 && m_string[begin - 1] == U'\n') ? U'\n' : 0;
+    for (std::size_t i = begin; i < index; ++i)
     {
         const std::uint32_t curChar = m_string[i];
 
@@ -316,6 +422,15 @@ Vector2f Text::findCharacterPos(std::size_t index) const
 }
 
 
+////////////////////////////////////////////////////////////
+std::size_t Text::getLineCount() const
+{
+    ensureGeometryUpdate();
+
+    return m_lines.size();
+}
+
+
 ////////////////////////////////////////////////////////////
 FloatRect Text::getLocalBounds() const
 {
@@ -335,41 +450,148 @@ FloatRect Text::getGlobalBounds() const
 ////////////////////////////////////////////////////////////
 void Text::draw(RenderTarget& target, RenderStates states) const
 {
+    // Updating the geometry may evict font pages that the pending draws of the target still refer to
+    if ((m_font->getMemoryBudget() != 0) &&
+        (m_geometryNeedUpdate || m_stringEdit || (m_font->getTexture(m_characterSize).m_cacheId != m_fontTextureId)))
+        target.flushBatch();
+
     ensureGeometryUpdate();
 
     states.transform *= getTransform();
     states.texture        = &m_font->getTexture(m_characterSize);
     states.coordinateType = CoordinateType::Pixels;
 
+    // Only draw the lines inside the view, unless a custom shader may move the vertices
+    // or the vertices are recorded to be drawn later, possibly with another view
+    std::size_t firstLine = 0;
+    std::size_t lastLine  = m_lines.size();
+    if (!states.shader && !target.isRecording() && (m_lines.size() > 1))
+    {
+        const FloatRect viewRect = target.getView().getInverseTransform().transformRect(FloatRect({-1.f, -1.f}, {2.f, 2.f}));
+        const FloatRect localRect = states.transform.getInverse().transformRect(viewRect);
+        const float     top       = localRect.position.y - m_lineExtent.y;
+        const float     bottom    = localRect.position.y + localRect.size.y + m_lineExtent.x;
+
+        // Lines are sorted by vertical position
+        const auto first = std::partition_point(m_lines.begin(), m_lines.end(), [top](const Line& line) { return line.y < top; });
+        const auto last  = std::partition_point(first, m_lines.end(), [bottom](const Line& line) { return line.y <= bottom; });
+        firstLine        = static_cast<std::size_t>(first - m_lines.begin());
+        lastLine         = static_cast<std::size_t>(last - m_lines.begin());
+    }
+
+    if (firstLine == lastLine)
+        return;
+
+    // Draw the lines in as few pieces as their vertices allow, each piece with its own translation
+    const auto drawLines = [&](const VertexArray& vertices, bool outline, const RenderStates& lineStates)
+    {
+        for (std::size_t line = firstLine; line < lastLine;)
+        {
+            const std::size_t pieceEnd = findPieceEnd(line, lastLine, outline);
+            const Line&       piece    = m_lines[line];
+            const std::size_t first    = outline ? piece.firstOutlineVertex : piece.firstVertex;
+            std::size_t       last     = first;
+            for (; line < pieceEnd; ++line)
+                last += outline ? m_lines[line].outlineVertexCount : m_lines[line].vertexCount;
+
+            RenderStates pieceStates = lineStates;
+            if (piece.translation != 0.f)
+                pieceStates.transform.translate({0.f, piece.translation});
+
+            // Draw the whole vertex array when all of it is visible
+            if ((first == 0) && (last == vertices.getVertexCount()))
+                target.draw(vertices, pieceStates);
+            else if (first < last)
+                target.draw(&vertices[first], last - first, PrimitiveType::Triangles, pieceStates);
+        }
+    };
+
+    // Distance field glyphs need the font's shader, unless a custom one is used
+    const bool useDistanceField = !states.shader && (m_font->getGlyphMode() == Font::GlyphMode::SignedDistanceField);
+
     // Only draw the outline if there is something to draw
     if (m_outlineThickness != 0)
-        target.draw(m_outlineVertices, states);
+    {
+        RenderStates outlineStates = states;
+        if (useDistanceField)
+            outlineStates.shader = m_font->getDistanceFieldShader(m_characterSize, m_outlineThickness);
+
+        drawLines(m_outlineVertices, true, outlineStates);
+    }
+
+    if (useDistanceField)
+        states.shader = m_font->getDistanceFieldShader(m_characterSize, 0);
+
+    drawLines(m_vertices, false, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::recordStringEdit(std::size_t position, std::size_t removed, std::size_t inserted)
+{
+    // The whole geometry will be updated anyway
+    if (m_geometryNeedUpdate)
+        return;
+
+    if (!m_stringEdit)
+    {
+        m_stringEdit = StringEdit{position, position + inserted};
+        return;
+    }
+
+    // Merge with the pending modification, moving its end along with the characters that follow the new one
+    StringEdit& edit = *m_stringEdit;
+    if (edit.end > position)
+        edit.end = (edit.end >= position + removed) ? edit.end - removed + inserted : position + inserted;
 
-    target.draw(m_vertices, states);
+    edit.begin = std::min(edit.begin, position);
+    edit.end   = std::max(edit.end, position + inserted);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate() const
 {
+    updateGeometry();
+
+    // The memory budget of the font may reset its page while the glyphs are laid out, the glyphs laid
+    // out before that then point to the cleared texture. Lay the text out again, but only once: if its
+    // glyphs don't fit in the budget at all, every layout resets the page again
+    if (m_font->getTexture(m_characterSize).m_cacheId != m_fontTextureId)
+        updateGeometry();
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::updateGeometry() const
+{
+    const std::uint64_t fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
+
     // Do nothing, if geometry has not changed and the font texture has not changed
-    if (!m_geometryNeedUpdate && m_font->getTexture(m_characterSize).m_cacheId == m_fontTextureId)
+    if (!m_geometryNeedUpdate && !m_stringEdit && fontTextureId == m_fontTextureId)
         return;
 
+    // Lines can only be updated separately if nothing but the string changed since they were built,
+    // and if their alignment doesn't depend on the widest one
+    const bool fullUpdate = m_geometryNeedUpdate || (fontTextureId != m_fontTextureId) || m_lines.empty() ||
+                            ((m_maxWidth <= 0) && (m_alignment != Alignment::Left)) || isGeometryFragmented();
+
     // Save the current fonts texture id
-    m_fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
+    m_fontTextureId = fontTextureId;
 
     // Mark geometry as updated
-    m_geometryNeedUpdate = false;
-
-    // Clear the previous geometry
-    m_vertices.clear();
-    m_outlineVertices.clear();
-    m_bounds = FloatRect();
+    m_geometryNeedUpdate                 = false;
+    const std::optional<StringEdit> edit = std::exchange(m_stringEdit, std::nullopt);
 
     // No text: nothing to draw
     if (m_string.isEmpty())
+    {
+        m_vertices.clear();
+        m_outlineVertices.clear();
+        m_lines.clear();
+        m_bounds = FloatRect();
         return;
+    }
 
     // Compute values related to the text style
     const bool  isBold             = m_style & Bold;
@@ -389,99 +611,358 @@ void Text::ensureGeometryUpdate() const
     const float letterSpacing   = (whitespaceWidth / 3.f) * (m_letterSpacingFactor - 1.f);
     whitespaceWidth += letterSpacing;
     const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
-    float       x           = 0.f;
-    auto        y           = static_cast<float>(m_characterSize);
-
-    // Create one quad for each character
-    auto          minX     = static_cast<float>(m_characterSize);
-    auto          minY     = static_cast<float>(m_characterSize);
-    float         maxX     = 0.f;
-    float         maxY     = 0.f;
-    std::uint32_t prevChar = 0;
-    for (const std::uint32_t curChar : m_string)
-    {
-        // Skip the \r char to avoid weird graphical issues
-        if (curChar == U'\r')
-            continue;
 
-        // Apply the kerning offset
-        x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+    // Glyph quads must not sample the texture beyond the padding of the glyphs
+    const float fillTexturePadding    = m_font->getGlyphTexturePadding(m_characterSize, 0);
+    const float outlineTexturePadding = m_font->getGlyphTexturePadding(m_characterSize, m_outlineThickness);
 
-        // If we're using the underlined style and there's a new line, draw a line
-        if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
+    // Find where the line starting at the given position ends, wrapping it if it is too wide
+    const auto findLineEnd = [&](std::size_t begin)
+    {
+        // Without a maximum width, lines only end with new lines
+        if (m_maxWidth <= 0)
         {
-            addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+            for (std::size_t index = begin; index < m_string.getSize(); ++index)
+            {
+                if (m_string[index] == U'\n')
+                    return index + 1;
+            }
 
-            if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+            return m_string.getSize();
         }
 
-        // If we're using the strike through style and there's a new line, draw a line across all characters
-        if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
+        float                      x        = 0.f;
+        std::uint32_t              prevChar = (begin > 0 && m_string[begin - 1] == U'\n') ? U'\n' : 0;
+        std::optional<std::size_t> lastWhitespace;
+        for (std::size_t index = begin; index < m_string.getSize(); ++index)
         {
-            addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
-
-            if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
-        }
+            const std::uint32_t curChar = m_string[index];
+            if (curChar == U'\r')
+                continue;
 
-        prevChar = curChar;
-
-        // Handle special characters
-        if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
-        {
-            // Update the current bounds (min coordinates)
-            minX = std::min(minX, x);
-            minY = std::min(minY, y);
+            x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+            prevChar = curChar;
 
             switch (curChar)
             {
                 case U' ':
                     x += whitespaceWidth;
-                    break;
+                    lastWhitespace = index;
+                    continue;
                 case U'\t':
                     x += whitespaceWidth * 4;
-                    break;
+                    lastWhitespace = index;
+                    continue;
                 case U'\n':
-                    y += lineSpacing;
-                    x = 0;
-                    break;
+                    return index + 1;
             }
 
-            // Update the current bounds (max coordinates)
-            maxX = std::max(maxX, x);
-            maxY = std::max(maxY, y);
+            // Wrap before the first character that doesn't fit, keeping at least one character per line
+            const float advance = m_font->getGlyph(curChar, m_characterSize, isBold).advance;
+            if ((index > begin) && (x + advance > m_maxWidth))
+                return lastWhitespace ? *lastWhitespace + 1 : index;
 
-            // Next glyph, no need to create a quad for whitespace
-            continue;
+            x += advance + letterSpacing;
+        }
+
+        return m_string.getSize();
+    };
+
+    // Append the geometry of the characters of a line to the vertices
+    const auto layoutLine = [&](std::size_t begin, std::size_t end, float y)
+    {
+        Line line;
+        line.y                  = y;
+        line.min                = Vector2f(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+        line.max                = Vector2f(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+        line.firstVertex        = m_vertices.getVertexCount();
+        line.firstOutlineVertex = m_outlineVertices.getVertexCount();
+
+        // Create one quad for each character
+        float         x        = 0.f;
+        std::uint32_t prevChar = (begin > 0 && m_string[begin - 1] == U'\n') ? U'\n' : 0;
+        for (std::size_t index = begin; index < end; ++index)
+        {
+            const std::uint32_t curChar = m_string[index];
+
+            // Skip the \r char to avoid weird graphical issues
+            if (curChar == U'\r')
+                continue;
+
+            // Apply the kerning offset
+            x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+
+            // If we're using the underlined style and there's a new line, draw a line
+            if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
+            {
+                addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+
+                if (m_outlineThickness != 0)
+                    addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+            }
+
+            // If we're using the strike through style and there's a new line, draw a line across all characters
+            if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
+            {
+                addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+
+                if (m_outlineThickness != 0)
+                    addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+            }
+
+            prevChar = curChar;
+
+            // Handle special characters
+            if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
+            {
+                // Update the current bounds (min coordinates)
+                line.min.x = std::min(line.min.x, x);
+                line.min.y = std::min(line.min.y, y);
+
+                switch (curChar)
+                {
+                    case U' ':
+                        x += whitespaceWidth;
+                        break;
+                    case U'\t':
+                        x += whitespaceWidth * 4;
+                        break;
+                    case U'\n':
+                        y += lineSpacing;
+                        x            = 0;
+                        line.newLine = true;
+                        break;
+                }
+
+                // Update the current bounds (max coordinates)
+                line.max.x = std::max(line.max.x, x);
+                line.max.y = std::max(line.max.y, y);
+
+                // Next glyph, no need to create a quad for whitespace
+                continue;
+            }
+
+            // Apply the outline
+            if (m_outlineThickness != 0)
+            {
+                const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
+
+                // Add the outline glyph to the vertices
+                addGlyphQuad(m_outlineVertices,
+                             Vector2f(x, y),
+                             m_outlineColor,
+                             glyph,
+                             italicShear,
+                             outlineTexturePadding);
+            }
+
+            // Extract the current glyph's description
+            const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
+
+            // Add the glyph to the vertices
+            addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear, fillTexturePadding);
+
+            // Update the current bounds
+            const Vector2f p1 = glyph.bounds.position;
+            const Vector2f p2 = glyph.bounds.position + glyph.bounds.size;
+
+            line.min.x = std::min(line.min.x, x + p1.x - italicShear * p2.y);
+            line.max.x = std::max(line.max.x, x + p2.x - italicShear * p1.y);
+            line.min.y = std::min(line.min.y, y + p1.y);
+            line.max.y = std::max(line.max.y, y + p2.y);
+
+            // Advance to the next character
+            x += glyph.advance + letterSpacing;
+            line.width = x;
         }
 
-        // Apply the outline
-        if (m_outlineThickness != 0)
+        // The last line and wrapped lines aren't terminated by a new line, add their lines now
+        if (!line.newLine)
         {
-            const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
+            // If we're using the underlined style, add the last line
+            if (isUnderlined && (x > 0))
+            {
+                addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+
+                if (m_outlineThickness != 0)
+                    addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+            }
+
+            // If we're using the strike through style, add the last line across all characters
+            if (isStrikeThrough && (x > 0))
+            {
+                addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
 
-            // Add the outline glyph to the vertices
-            addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
+                if (m_outlineThickness != 0)
+                    addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+            }
         }
 
-        // Extract the current glyph's description
-        const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
+        line.length             = end - begin;
+        line.vertexCount        = m_vertices.getVertexCount() - line.firstVertex;
+        line.outlineVertexCount = m_outlineVertices.getVertexCount() - line.firstOutlineVertex;
 
-        // Add the glyph to the vertices
-        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
+        // Lines can be aligned right away within the maximum width, otherwise the widest line is needed first
+        if ((m_maxWidth > 0) && (m_alignment != Alignment::Left))
+            alignLine(line, (m_maxWidth - line.width) * (m_alignment == Alignment::Center ? 0.5f : 1.f));
 
-        // Update the current bounds
-        const Vector2f p1 = glyph.bounds.position;
-        const Vector2f p2 = glyph.bounds.position + glyph.bounds.size;
+        return line;
+    };
 
-        minX = std::min(minX, x + p1.x - italicShear * p2.y);
-        maxX = std::max(maxX, x + p2.x - italicShear * p1.y);
-        minY = std::min(minY, y + p1.y);
-        maxY = std::max(maxY, y + p2.y);
+    // Find the first paragraph touched by the modification of the string, the ones before it are left untouched
+    const bool  partialUpdate = !fullUpdate && edit.has_value();
+    std::size_t firstLine     = 0;
+    std::size_t firstBegin    = 0;
+    if (partialUpdate)
+    {
+        std::size_t lineEnd = 0;
+        for (std::size_t i = 0; i + 1 < m_lines.size(); ++i)
+        {
+            lineEnd += m_lines[i].length;
+            if (lineEnd > edit->begin)
+                break;
 
-        // Advance to the next character
-        x += glyph.advance + letterSpacing;
+            if (m_lines[i].newLine)
+            {
+                firstLine  = i + 1;
+                firstBegin = lineEnd;
+            }
+        }
+    }
+    else
+    {
+        m_vertices.clear();
+        m_outlineVertices.clear();
+        m_lines.clear();
+    }
+
+    // Keep the following lines aside, their geometry may still be valid after the modification
+    const std::vector<Line> oldLines(m_lines.begin() + static_cast<std::ptrdiff_t>(firstLine), m_lines.end());
+
+    std::size_t oldSize = firstBegin;
+    for (const Line& line : oldLines)
+        oldSize += line.length;
+
+    float y = oldLines.empty() ? static_cast<float>(m_characterSize) : oldLines.front().y;
+    m_lines.resize(firstLine);
+
+    // New lines are laid out after all the existing vertices, the old ones are still in use by the reused lines
+    const std::size_t layoutVertex        = m_vertices.getVertexCount();
+    const std::size_t layoutOutlineVertex = m_outlineVertices.getVertexCount();
+    std::size_t       reusedLines         = 0;
+
+    // Lay out the lines until the end of the string, or until the rest of it lines up with an old paragraph again
+    std::size_t begin = firstBegin;
+    for (;;)
+    {
+        const std::size_t end = findLineEnd(begin);
+        m_lines.push_back(layoutLine(begin, end, y));
+        begin = end;
+
+        // Only the last line ends at the end of the string
+        if (begin >= m_string.getSize())
+            break;
+
+        y += lineSpacing;
+
+        // Past the modified characters, paragraphs are unchanged and only need to be moved vertically
+        if (partialUpdate && m_lines.back().newLine && (begin > edit->end))
+        {
+            const std::size_t oldBegin = begin + oldSize - m_string.getSize();
+
+            std::size_t line      = 0;
+            std::size_t lineBegin = firstBegin;
+            while ((line < oldLines.size()) && (lineBegin < oldBegin))
+                lineBegin += oldLines[line++].length;
+
+            if ((line > 0) && (line < oldLines.size()) && (lineBegin == oldBegin) && oldLines[line - 1].newLine)
+            {
+                // Reused lines keep their vertices where they are, they are translated when drawn instead
+                reusedLines = oldLines.size() - line;
+                for (; line < oldLines.size(); ++line)
+                {
+                    Line&          reused = m_lines.emplace_back(oldLines[line]);
+                    const Vector2f offset(0.f, y - reused.y);
+
+                    reused.y = y;
+                    reused.translation += offset.y;
+                    reused.min += offset;
+                    reused.max += offset;
+                    y += lineSpacing;
+                }
+
+                break;
+            }
+        }
+    }
+
+    // Move the vertices of the new lines into the place of the lines they replace, if they fit
+    const auto reclaimVertices = [&](VertexArray& vertices, std::size_t layoutStart, bool outline)
+    {
+        std::size_t Line::*const first = outline ? &Line::firstOutlineVertex : &Line::firstVertex;
+        std::size_t Line::*const count = outline ? &Line::outlineVertexCount : &Line::vertexCount;
+
+        // The replaced vertices can only be reclaimed if they are next to each other
+        std::optional<std::size_t> holeBegin;
+        std::size_t                holeEnd = 0;
+        for (std::size_t i = 0; i + reusedLines < oldLines.size(); ++i)
+        {
+            const Line& replaced = oldLines[i];
+            if (replaced.*count == 0)
+                continue;
+
+            if (!holeBegin)
+                holeBegin = replaced.*first;
+            else if (replaced.*first != holeEnd)
+                return;
+
+            holeEnd = replaced.*first + replaced.*count;
+        }
+
+        // Vertices left behind in the middle of the array stay unused until the next full update
+        const std::size_t laidOut = vertices.getVertexCount() - layoutStart;
+        if (!holeBegin || ((holeEnd != layoutStart) && (laidOut > holeEnd - *holeBegin)))
+            return;
+
+        for (std::size_t i = 0; i < laidOut; ++i)
+            vertices[*holeBegin + i] = vertices[layoutStart + i];
+
+        for (std::size_t i = firstLine; i + reusedLines < m_lines.size(); ++i)
+            m_lines[i].*first = m_lines[i].*first - layoutStart + *holeBegin;
+
+        vertices.resize((holeEnd == layoutStart) ? *holeBegin + laidOut : layoutStart);
+    };
+
+    if (partialUpdate)
+    {
+        reclaimVertices(m_vertices, layoutVertex, false);
+        reclaimVertices(m_outlineVertices, layoutOutlineVertex, true);
+    }
+
+    // Without a maximum width, lines are aligned within the widest one
+    if ((m_maxWidth <= 0) && (m_alignment != Alignment::Left))
+    {
+        float width = 0.f;
+        for (const Line& line : m_lines)
+            width = std::max(width, line.width);
+
+        for (Line& line : m_lines)
+            alignLine(line, (width - line.width) * (m_alignment == Alignment::Center ? 0.5f : 1.f));
+    }
+
+    // Update the bounding rectangle, and how far the lines extend around their vertical position
+    auto  minX = static_cast<float>(m_characterSize);
+    auto  minY = static_cast<float>(m_characterSize);
+    float maxX = 0.f;
+    float maxY = 0.f;
+    m_lineExtent = Vector2f();
+    for (const Line& line : m_lines)
+    {
+        minX         = std::min(minX, line.min.x);
+        minY         = std::min(minY, line.min.y);
+        maxX         = std::max(maxX, line.max.x);
+        maxY         = std::max(maxY, line.max.y);
+        m_lineExtent = Vector2f(std::max(m_lineExtent.x, line.y - line.min.y), std::max(m_lineExtent.y, line.max.y - line.y));
     }
 
     // If we're using outline, update the current bounds
@@ -492,29 +973,78 @@ void Text::ensureGeometryUpdate() const
         maxX += outline;
         minY -= outline;
         maxY += outline;
+        m_lineExtent += Vector2f(outline, outline);
     }
 
-    // If we're using the underlined style, add the last line
-    if (isUnderlined && (x > 0))
+    m_bounds.position = Vector2f(minX, minY);
+    m_bounds.size     = Vector2f(maxX, maxY) - Vector2f(minX, minY);
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::alignLine(Line& line, float offset) const
+{
+    const Vector2f move(offset - line.offset, 0.f);
+    if (move.x == 0.f)
+        return;
+
+    for (std::size_t i = 0; i < line.vertexCount; ++i)
+        m_vertices[line.firstVertex + i].position += move;
+
+    for (std::size_t i = 0; i < line.outlineVertexCount; ++i)
+        m_outlineVertices[line.firstOutlineVertex + i].position += move;
+
+    line.offset = offset;
+    line.min += move;
+    line.max += move;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Text::findPieceEnd(std::size_t line, std::size_t lastLine, bool outline) const
+{
+    std::size_t Line::*const first = outline ? &Line::firstOutlineVertex : &Line::firstVertex;
+    std::size_t Line::*const count = outline ? &Line::outlineVertexCount : &Line::vertexCount;
+
+    // Lines are drawn along with the previous ones as long as their vertices follow them, with the same translation
+    const float translation = m_lines[line].translation;
+    std::size_t vertexEnd   = m_lines[line].*first + m_lines[line].*count;
+    for (++line; line < lastLine; ++line)
     {
-        addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+        const Line& next = m_lines[line];
+        if (next.*count == 0)
+            continue;
 
-        if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+        if ((next.translation != translation) || (next.*first != vertexEnd))
+            break;
+
+        vertexEnd += next.*count;
     }
 
-    // If we're using the strike through style, add the last line across all characters
-    if (isStrikeThrough && (x > 0))
-    {
-        addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+    return line;
+}
 
-        if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+
+////////////////////////////////////////////////////////////
+bool Text::isGeometryFragmented() const
+{
+    // Lines reused by partial updates keep their vertices where they were, and may leave unused ones behind
+    std::size_t pieces              = 0;
+    std::size_t usedVertices        = 0;
+    std::size_t usedOutlineVertices = 0;
+    for (std::size_t line = 0; line < m_lines.size(); line = findPieceEnd(line, m_lines.size(), false))
+        ++pieces;
+    for (std::size_t line = 0; line < m_lines.size(); line = findPieceEnd(line, m_lines.size(), true))
+        ++pieces;
+    for (const Line& line : m_lines)
+    {
+        usedVertices += line.vertexCount;
+        usedOutlineVertices += line.outlineVertexCount;
     }
 
-    // Update the bounding rectangle
-    m_bounds.position = Vector2f(minX, minY);
-    m_bounds.size     = Vector2f(maxX, maxY) - Vector2f(minX, minY);
+    // A few pieces are cheap to draw, but laying the whole text out again beats drawing many of them
+    return (pieces > 16) || (m_vertices.getVertexCount() > usedVertices * 2) ||
+           (m_outlineVertices.getVertexCount() > usedOutlineVertices * 2);
 }
 
 } // namespace sf
@@ -60,6 +60,35 @@ std::uint64_t getUniqueId() noexcept
 
     return id.fetch_add(1);
 }
+
+#ifndef SFML_OPENGL_ES
+
+// Copy the pixels of a texture read at its actual size, removing the padding and undoing the flipping
+void copyVisiblePixels(const std::uint8_t* src,
+                       sf::Vector2u        actualSize,
+                       sf::Vector2u        size,
+                       bool                flipped,
+                       std::uint8_t*       dst)
+{
+    auto              srcPitch = static_cast<std::ptrdiff_t>(actualSize.x) * 4;
+    const std::size_t dstPitch = std::size_t{size.x} * 4;
+
+    // Handle the case where source pixels are flipped vertically
+    if (flipped)
+    {
+        src += srcPitch * static_cast<std::ptrdiff_t>(size.y - 1);
+        srcPitch = -srcPitch;
+    }
+
+    for (unsigned int i = 0; i < size.y; ++i)
+    {
+        std::memcpy(dst, src, dstPitch);
+        src += srcPitch;
+        dst += dstPitch;
+    }
+}
+
+#endif // SFML_OPENGL_ES
 } // namespace TextureImpl
 } // namespace
 
@@ -515,29 +544,68 @@ Image Texture::copyToImage() const
         glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, allPixels.data()));
 
         // Then we copy the useful pixels from the temporary array to the final one
-        const std::uint8_t* src      = allPixels.data();
-        std::uint8_t*       dst      = pixels.data();
-        int                 srcPitch = static_cast<int>(m_actualSize.x * 4);
-        const unsigned int  dstPitch = m_size.x * 4;
+        TextureImpl::copyVisiblePixels(allPixels.data(), m_actualSize, m_size, m_pixelsFlipped, pixels.data());
+    }
 
-        // Handle the case where source pixels are flipped vertically
-        if (m_pixelsFlipped)
-        {
-            src += static_cast<unsigned int>(srcPitch * static_cast<int>(m_size.y - 1));
-            srcPitch = -srcPitch;
-        }
+#endif // SFML_OPENGL_ES
 
-        for (unsigned int i = 0; i < m_size.y; ++i)
-        {
-            std::memcpy(dst, src, dstPitch);
-            src += srcPitch;
-            dst += dstPitch;
-        }
+    return {m_size, pixels.data()};
+}
+
+
+////////////////////////////////////////////////////////////
+Texture::Readback Texture::copyToImageAsync() const
+{
+    Readback readback;
+
+    // Easy case: empty texture
+    if (!m_texture)
+        return readback;
+
+    readback.m_size = m_size;
+
+#ifndef SFML_OPENGL_ES
+
+    const TransientContextLock lock;
+
+    if (GLEXT_vertex_buffer_object && GLEXT_pixel_buffer_object)
+    {
+        // Make sure that the current texture binding will be preserved
+        const priv::TextureSaver save;
+
+        readback.m_actualSize = m_actualSize;
+        readback.m_flipped    = m_pixelsFlipped;
+
+        // Read the whole texture into a pixel buffer object, the pixel pointer
+        // is interpreted as an offset into the buffer so the call doesn't block;
+        // the padding and the flipping are dealt with when the pixels are retrieved
+        glCheck(GLEXT_glGenBuffers(1, &readback.m_buffer));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, readback.m_buffer));
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                   static_cast<GLsizeiptrARB>(std::size_t{m_actualSize.x} * m_actualSize.y * 4),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_READ));
+        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+        if (GLEXT_sync)
+            readback.m_fence = glCheck(GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+        // Force an OpenGL flush, so that the fence can be signaled
+        // even if the pixels are retrieved from another context
+        glCheck(glFlush());
+
+        return readback;
     }
 
 #endif // SFML_OPENGL_ES
 
-    return {m_size, pixels.data()};
+    // Without pixel buffer objects, the pixels can only be copied right away
+    const Image image = copyToImage();
+    readback.m_pixels.assign(image.getPixelsPtr(), image.getPixelsPtr() + std::size_t{m_size.x} * m_size.y * 4);
+
+    return readback;
 }
 
 
@@ -585,6 +653,126 @@ void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
 }
 
 
+////////////////////////////////////////////////////////////
+Texture::Upload Texture::beginUpload(Vector2u size, Vector2u dest)
+{
+    assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
+    assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
+
+    Upload upload;
+
+    if (!m_texture || size.x == 0 || size.y == 0)
+        return upload;
+
+    upload.m_size = size;
+    upload.m_dest = dest;
+
+    const std::size_t byteSize = std::size_t{size.x} * std::size_t{size.y} * 4;
+
+#ifndef SFML_OPENGL_ES
+
+    const TransientContextLock lock;
+
+    if (GLEXT_vertex_buffer_object && GLEXT_pixel_buffer_object)
+    {
+        // Stage the pixels in a mapped pixel buffer object, so that they can be
+        // written from any thread and copied to the texture by the graphics card
+        glCheck(GLEXT_glGenBuffers(1, &upload.m_buffer));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, upload.m_buffer));
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_UNPACK_BUFFER,
+                                   static_cast<GLsizeiptrARB>(byteSize),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_DRAW));
+        upload.m_pixels = static_cast<std::uint8_t*>(
+            glCheck(GLEXT_glMapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, GLEXT_GL_WRITE_ONLY)));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+
+        if (upload.m_pixels)
+            return upload;
+
+        // The buffer couldn't be mapped, fall back to client memory
+        glCheck(GLEXT_glDeleteBuffers(1, &upload.m_buffer));
+        upload.m_buffer = 0;
+    }
+
+#endif // SFML_OPENGL_ES
+
+    upload.m_fallback.resize(byteSize);
+    upload.m_pixels = upload.m_fallback.data();
+
+    return upload;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::submitUpload(Upload& upload)
+{
+    assert(upload.m_dest.x + upload.m_size.x <= m_size.x && "Destination x coordinate is outside of texture");
+    assert(upload.m_dest.y + upload.m_size.y <= m_size.y && "Destination y coordinate is outside of texture");
+
+    if (!upload.m_pixels || upload.m_submitted || !m_texture)
+        return false;
+
+    upload.m_submitted = true;
+
+    // Without a pixel buffer object, the upload is a regular update from client memory
+    if (!upload.m_buffer)
+    {
+        update(upload.m_pixels, upload.m_size, upload.m_dest);
+        upload.m_pixels   = nullptr;
+        upload.m_fallback = {};
+        return true;
+    }
+
+#ifndef SFML_OPENGL_ES
+
+    const TransientContextLock lock;
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, upload.m_buffer));
+    const GLboolean unmapResult = glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER));
+    upload.m_pixels             = nullptr;
+
+    if (unmapResult == GL_FALSE)
+    {
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+        err() << "Failed to submit texture upload, its pixels were lost while mapped" << std::endl;
+        return false;
+    }
+
+    // Copy the pixels from the bound pixel buffer object to the texture,
+    // the pixel pointer is interpreted as an offset into the buffer
+    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                            0,
+                            static_cast<GLint>(upload.m_dest.x),
+                            static_cast<GLint>(upload.m_dest.y),
+                            static_cast<GLsizei>(upload.m_size.x),
+                            static_cast<GLsizei>(upload.m_size.y),
+                            GL_RGBA,
+                            GL_UNSIGNED_BYTE,
+                            nullptr));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+    m_hasMipmap     = false;
+    m_pixelsFlipped = false;
+    m_cacheId       = TextureImpl::getUniqueId();
+
+    if (GLEXT_sync)
+        upload.m_fence = glCheck(GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    // Force an OpenGL flush, so that the texture data will appear updated
+    // in all contexts and the fence can be signaled
+    glCheck(glFlush());
+
+#endif // SFML_OPENGL_ES
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::update(const Texture& texture)
 {
@@ -916,6 +1104,43 @@ void Texture::invalidateMipmap()
 }
 
 
+////////////////////////////////////////////////////////////
+std::array<float, 16> Texture::getMatrix(CoordinateType coordinateType) const
+{
+    // clang-format off
+    std::array matrix = {1.f, 0.f, 0.f, 0.f,
+                         0.f, 1.f, 0.f, 0.f,
+                         0.f, 0.f, 1.f, 0.f,
+                         0.f, 0.f, 0.f, 1.f};
+    // clang-format on
+
+    // If non-normalized coordinates (= pixels) are requested, we need to
+    // setup scale factors that convert the range [0 .. size] to [0 .. 1]
+    if (coordinateType == CoordinateType::Pixels)
+    {
+        matrix[0] = 1.f / static_cast<float>(m_actualSize.x);
+        matrix[5] = 1.f / static_cast<float>(m_actualSize.y);
+    }
+
+    // If normalized coordinates are used when NPOT textures aren't supported,
+    // then we need to setup scale factors to make the coordinates relative to the actual POT size
+    if ((coordinateType == CoordinateType::Normalized) && (m_size != m_actualSize))
+    {
+        matrix[0] = static_cast<float>(m_size.x) / static_cast<float>(m_actualSize.x);
+        matrix[5] = static_cast<float>(m_size.y) / static_cast<float>(m_actualSize.y);
+    }
+
+    // If pixels are flipped we must invert the Y axis
+    if (m_pixelsFlipped)
+    {
+        matrix[5]  = -matrix[5];
+        matrix[13] = static_cast<float>(m_size.y) / static_cast<float>(m_actualSize.y);
+    }
+
+    return matrix;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::bind(const Texture* texture, CoordinateType coordinateType)
 {
@@ -930,50 +1155,9 @@ void Texture::bind(const Texture* texture, CoordinateType coordinateType)
         // Bind the texture
         glCheck(glBindTexture(GL_TEXTURE_2D, texture->m_texture));
 
-        // Check if we need to define a special texture matrix
-        if ((coordinateType == CoordinateType::Pixels) || texture->m_pixelsFlipped ||
-            ((coordinateType == CoordinateType::Normalized) && (texture->m_size != texture->m_actualSize)))
-        {
-            // clang-format off
-            std::array matrix = {1.f, 0.f, 0.f, 0.f,
-                                 0.f, 1.f, 0.f, 0.f,
-                                 0.f, 0.f, 1.f, 0.f,
-                                 0.f, 0.f, 0.f, 1.f};
-            // clang-format on
-
-            // If non-normalized coordinates (= pixels) are requested, we need to
-            // setup scale factors that convert the range [0 .. size] to [0 .. 1]
-            if (coordinateType == CoordinateType::Pixels)
-            {
-                matrix[0] = 1.f / static_cast<float>(texture->m_actualSize.x);
-                matrix[5] = 1.f / static_cast<float>(texture->m_actualSize.y);
-            }
-
-            // If normalized coordinates are used when NPOT textures aren't supported,
-            // then we need to setup scale factors to make the coordinates relative to the actual POT size
-            if ((coordinateType == CoordinateType::Normalized) && (texture->m_size != texture->m_actualSize))
-            {
-                matrix[0] = static_cast<float>(texture->m_size.x) / static_cast<float>(texture->m_actualSize.x);
-                matrix[5] = static_cast<float>(texture->m_size.y) / static_cast<float>(texture->m_actualSize.y);
-            }
-
-            // If pixels are flipped we must invert the Y axis
-            if (texture->m_pixelsFlipped)
-            {
-                matrix[5]  = -matrix[5];
-                matrix[13] = static_cast<float>(texture->m_size.y) / static_cast<float>(texture->m_actualSize.y);
-            }
-
-            // Load the matrix
-            glCheck(glMatrixMode(GL_TEXTURE));
-            glCheck(glLoadMatrixf(matrix.data()));
-        }
-        else
-        {
-            // Reset the texture matrix
-            glCheck(glMatrixMode(GL_TEXTURE));
-            glCheck(glLoadIdentity());
-        }
+        // Load the texture matrix
+        glCheck(glMatrixMode(GL_TEXTURE));
+        glCheck(glLoadMatrixf(texture->getMatrix(coordinateType).data()));
 
         // Go back to model-view mode (sf::RenderTarget relies on it)
         glCheck(glMatrixMode(GL_MODELVIEW));
@@ -1066,6 +1250,268 @@ unsigned int Texture::getValidSize(unsigned int size)
 }
 
 
+////////////////////////////////////////////////////////////
+Texture::Upload::~Upload()
+{
+#ifndef SFML_OPENGL_ES
+
+    if (!m_buffer && !m_fence)
+        return;
+
+    const TransientContextLock lock;
+
+    // A buffer that is still mapped is implicitly unmapped when deleted
+    if (m_buffer)
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+
+    if (m_fence)
+        glCheck(GLEXT_glDeleteSync(static_cast<GLsync>(m_fence)));
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+Texture::Upload::Upload(Upload&& source) noexcept :
+m_buffer(std::exchange(source.m_buffer, 0)),
+m_fallback(std::move(source.m_fallback)),
+m_pixels(std::exchange(source.m_pixels, nullptr)),
+m_size(std::exchange(source.m_size, {})),
+m_dest(std::exchange(source.m_dest, {})),
+m_fence(std::exchange(source.m_fence, nullptr)),
+m_submitted(std::exchange(source.m_submitted, false))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Texture::Upload& Texture::Upload::operator=(Upload&& right) noexcept
+{
+    // Catch self-moving.
+    if (&right == this)
+        return *this;
+
+    // Release our resources through a temporary
+    Upload temp(std::move(right));
+
+    std::swap(m_buffer, temp.m_buffer);
+    std::swap(m_fallback, temp.m_fallback);
+    std::swap(m_pixels, temp.m_pixels);
+    std::swap(m_size, temp.m_size);
+    std::swap(m_dest, temp.m_dest);
+    std::swap(m_fence, temp.m_fence);
+    std::swap(m_submitted, temp.m_submitted);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint8_t* Texture::Upload::getPixels() const
+{
+    return m_pixels;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u Texture::Upload::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::Upload::isComplete() const
+{
+    if (!m_submitted)
+        return false;
+
+#ifndef SFML_OPENGL_ES
+
+    // Without a fence, the copy is only known to be ordered before later commands
+    if (m_fence)
+    {
+        const TransientContextLock lock;
+
+        auto* const fence = static_cast<GLsync>(m_fence);
+
+        if (glCheck(GLEXT_glClientWaitSync(fence, 0, 0)) == GLEXT_GL_TIMEOUT_EXPIRED)
+            return false;
+
+        glCheck(GLEXT_glDeleteSync(fence));
+        m_fence = nullptr;
+    }
+
+#endif // SFML_OPENGL_ES
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+Texture::Readback::~Readback()
+{
+    release();
+}
+
+
+////////////////////////////////////////////////////////////
+Texture::Readback::Readback(Readback&& source) noexcept :
+m_buffer(std::exchange(source.m_buffer, 0)),
+m_pixels(std::move(source.m_pixels)),
+m_size(std::exchange(source.m_size, {})),
+m_actualSize(std::exchange(source.m_actualSize, {})),
+m_fence(std::exchange(source.m_fence, nullptr)),
+m_flipped(std::exchange(source.m_flipped, false))
+{
+    source.m_pixels.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+Texture::Readback& Texture::Readback::operator=(Readback&& right) noexcept
+{
+    // Catch self-moving.
+    if (&right == this)
+        return *this;
+
+    // Release our resources through a temporary
+    Readback temp(std::move(right));
+
+    std::swap(m_buffer, temp.m_buffer);
+    std::swap(m_pixels, temp.m_pixels);
+    std::swap(m_size, temp.m_size);
+    std::swap(m_actualSize, temp.m_actualSize);
+    std::swap(m_fence, temp.m_fence);
+    std::swap(m_flipped, temp.m_flipped);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::Readback::isValid() const
+{
+    return m_buffer || !m_pixels.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::Readback::isReady() const
+{
+    if (!isValid())
+        return false;
+
+#ifndef SFML_OPENGL_ES
+
+    if (m_fence)
+    {
+        const TransientContextLock lock;
+
+        auto* const fence = static_cast<GLsync>(m_fence);
+
+        if (glCheck(GLEXT_glClientWaitSync(fence, 0, 0)) == GLEXT_GL_TIMEOUT_EXPIRED)
+            return false;
+
+        glCheck(GLEXT_glDeleteSync(fence));
+        m_fence = nullptr;
+    }
+
+#endif // SFML_OPENGL_ES
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+Image Texture::Readback::get()
+{
+    if (!isValid())
+        return {};
+
+    std::vector<std::uint8_t> pixels = std::move(m_pixels);
+    m_pixels.clear();
+
+#ifndef SFML_OPENGL_ES
+
+    if (m_buffer)
+    {
+        const TransientContextLock lock;
+
+        // Wait until the graphics card has written the pixels to the buffer
+        if (m_fence)
+        {
+            auto* const fence = static_cast<GLsync>(m_fence);
+
+            while (glCheck(GLEXT_glClientWaitSync(fence, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000)) ==
+                   GLEXT_GL_TIMEOUT_EXPIRED)
+                ;
+        }
+
+        pixels.resize(std::size_t{m_size.x} * m_size.y * 4);
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, m_buffer));
+
+        const void* const source = glCheck(GLEXT_glMapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, GLEXT_GL_READ_ONLY));
+
+        if (source)
+        {
+            TextureImpl::copyVisiblePixels(static_cast<const std::uint8_t*>(source),
+                                           m_actualSize,
+                                           m_size,
+                                           m_flipped,
+                                           pixels.data());
+            glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER));
+        }
+        else
+        {
+            err() << "Failed to retrieve texture readback, its buffer could not be mapped" << std::endl;
+            pixels.clear();
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+    }
+
+#endif // SFML_OPENGL_ES
+
+    const Vector2u size = m_size;
+
+    release();
+
+    if (pixels.empty())
+        return {};
+
+    return {size, pixels.data()};
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::Readback::release()
+{
+#ifndef SFML_OPENGL_ES
+
+    if (m_buffer || m_fence)
+    {
+        const TransientContextLock lock;
+
+        if (m_buffer)
+            glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+
+        if (m_fence)
+            glCheck(GLEXT_glDeleteSync(static_cast<GLsync>(m_fence)));
+    }
+
+#endif // SFML_OPENGL_ES
+
+    m_buffer = 0;
+    m_pixels.clear();
+    m_size       = {};
+    m_actualSize = {};
+    m_fence      = nullptr;
+    m_flipped    = false;
+}
+
+
 ////////////////////////////////////////////////////////////
 void swap(Texture& left, Texture& right) noexcept
 {
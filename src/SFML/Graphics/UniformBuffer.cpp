@@ -0,0 +1,327 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+#include <utility>
+
+#include <cstddef>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace UniformBufferImpl
+{
+GLenum usageToGlEnum(sf::UniformBuffer::Usage usage)
+{
+    switch (usage)
+    {
+        case sf::UniformBuffer::Usage::Static:
+            return GLEXT_GL_STATIC_DRAW;
+        case sf::UniformBuffer::Usage::Dynamic:
+            return GLEXT_GL_DYNAMIC_DRAW;
+        default:
+            return GLEXT_GL_STREAM_DRAW;
+    }
+}
+} // namespace UniformBufferImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(Usage usage) : m_usage(usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(const UniformBuffer& copy) : GlResource(copy), m_usage(copy.m_usage)
+{
+    if (copy.m_buffer && copy.m_size)
+    {
+        if (!create(copy.m_size))
+        {
+            err() << "Could not create uniform buffer for copying" << std::endl;
+            return;
+        }
+
+        if (!update(copy))
+            err() << "Could not copy uniform buffer" << std::endl;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::~UniformBuffer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::create(std::size_t size)
+{
+    if (!isAvailable())
+    {
+        err() << "Could not create uniform buffer, uniform buffers are not supported" << std::endl;
+        return false;
+    }
+
+    const TransientContextLock contextLock;
+
+    if (!m_buffer)
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create uniform buffer, generation failed" << std::endl;
+        return false;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, m_buffer));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_UNIFORM_BUFFER,
+                               static_cast<GLsizeiptrARB>(size),
+                               nullptr,
+                               UniformBufferImpl::usageToGlEnum(m_usage)));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, 0));
+
+    m_size = size;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::update(const void* data)
+{
+    return update(data, m_size, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::update(const void* data, std::size_t size, std::size_t offset)
+{
+    // Sanity checks
+    if (!m_buffer)
+        return false;
+
+    if (!data)
+        return false;
+
+    if (offset && (offset + size > m_size))
+        return false;
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, m_buffer));
+
+    // Check if we need to resize or orphan the buffer
+    if (size >= m_size)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_UNIFORM_BUFFER,
+                                   static_cast<GLsizeiptrARB>(size),
+                                   nullptr,
+                                   UniformBufferImpl::usageToGlEnum(m_usage)));
+
+        m_size = size;
+    }
+
+    glCheck(GLEXT_glBufferSubData(GLEXT_GL_UNIFORM_BUFFER,
+                                  static_cast<GLintptrARB>(offset),
+                                  static_cast<GLsizeiptrARB>(size),
+                                  data));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, 0));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::update([[maybe_unused]] const UniformBuffer& uniformBuffer)
+{
+#ifdef SFML_OPENGL_ES
+
+    return false;
+
+#else
+
+    if (!m_buffer || !uniformBuffer.m_buffer)
+        return false;
+
+    const TransientContextLock contextLock;
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    if (GLEXT_copy_buffer)
+    {
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, uniformBuffer.m_buffer));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, m_buffer));
+
+        // Take the size of the other buffer, like the fallback below does
+        if (uniformBuffer.m_size != m_size)
+        {
+            glCheck(GLEXT_glBufferData(GLEXT_GL_COPY_WRITE_BUFFER,
+                                       static_cast<GLsizeiptrARB>(uniformBuffer.m_size),
+                                       nullptr,
+                                       UniformBufferImpl::usageToGlEnum(m_usage)));
+
+            m_size = uniformBuffer.m_size;
+        }
+
+        glCheck(GLEXT_glCopyBufferSubData(GLEXT_GL_COPY_READ_BUFFER,
+                                          GLEXT_GL_COPY_WRITE_BUFFER,
+                                          0,
+                                          0,
+                                          static_cast<GLsizeiptr>(uniformBuffer.m_size)));
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, 0));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, 0));
+
+        return true;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, m_buffer));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_UNIFORM_BUFFER,
+                               static_cast<GLsizeiptrARB>(uniformBuffer.m_size),
+                               nullptr,
+                               UniformBufferImpl::usageToGlEnum(m_usage)));
+
+    void* const destination = glCheck(GLEXT_glMapBuffer(GLEXT_GL_UNIFORM_BUFFER, GLEXT_GL_WRITE_ONLY));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, uniformBuffer.m_buffer));
+
+    const void* const source = glCheck(GLEXT_glMapBuffer(GLEXT_GL_UNIFORM_BUFFER, GLEXT_GL_READ_ONLY));
+
+    std::memcpy(destination, source, uniformBuffer.m_size);
+
+    const GLboolean sourceResult = glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_UNIFORM_BUFFER));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, m_buffer));
+
+    const GLboolean destinationResult = glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_UNIFORM_BUFFER));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, 0));
+
+    m_size = uniformBuffer.m_size;
+
+    return (sourceResult == GL_TRUE) && (destinationResult == GL_TRUE);
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer& UniformBuffer::operator=(const UniformBuffer& right)
+{
+    UniformBuffer temp(right);
+
+    swap(temp);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::swap(UniformBuffer& right) noexcept
+{
+    std::swap(m_buffer, right.m_buffer);
+    std::swap(m_size, right.m_size);
+    std::swap(m_usage, right.m_usage);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int UniformBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::setUsage(Usage usage)
+{
+    m_usage = usage;
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::Usage UniformBuffer::getUsage() const
+{
+    return m_usage;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::isAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_vertex_buffer_object && GLEXT_uniform_buffer_object;
+    }();
+
+    return available && Shader::isAvailable();
+}
+
+
+////////////////////////////////////////////////////////////
+void swap(UniformBuffer& left, UniformBuffer& right) noexcept
+{
+    left.swap(right);
+}
+
+} // namespace sf
@@ -33,13 +33,43 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <array>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 
 
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Ring of regions backing a streaming vertex buffer
+///
+/// The ring is split in segments as large as the largest
+/// region, and regions never straddle two segments. This way,
+/// a whole segment can be recycled once the GPU is done with it.
+///
+////////////////////////////////////////////////////////////
+struct VertexBufferRing
+{
+    static constexpr std::size_t segmentCount{3}; //!< Number of segments in the ring
+
+    std::size_t                      capacity{};    //!< Size in vertices of a segment, largest region to map
+    std::size_t                      head{};        //!< Position of the next free vertex in the ring
+    std::size_t                      segment{};     //!< Segment that the head is in
+    std::size_t                      regionFirst{}; //!< Position of the region being written
+    std::size_t                      regionCount{}; //!< Number of vertices in the region being written
+    Vertex*                          mapped{};      //!< Write pointer to the region being written, null if none
+    Vertex*                          persistent{};  //!< Persistent mapping of the whole ring, null if not used
+    std::array<GLsync, segmentCount> fences{};      //!< Fences signaled once the GPU is done with each segment
+    std::vector<Vertex>              staging;       //!< Staging memory, used when the buffer can't be mapped
+};
+} // namespace sf::priv
+
+
 namespace
 {
 // A nested named namespace is used here to allow unity builds of SFML.
@@ -57,12 +87,117 @@ GLenum usageToGlEnum(sf::VertexBuffer::Usage usage)
             return GLEXT_GL_STREAM_DRAW;
     }
 }
+
+// Check whether streaming buffers can be persistently mapped
+bool isPersistentMappingAvailable()
+{
+#ifdef SFML_OPENGL_ES
+
+    return false;
+
+#else
+
+    return GLEXT_buffer_storage && GLEXT_map_buffer_range && GLEXT_sync;
+
+#endif
+}
+
+
+// Release the fences of a ring, the context must be active
+void releaseFences([[maybe_unused]] sf::priv::VertexBufferRing& ring)
+{
+#ifndef SFML_OPENGL_ES
+
+    for (GLsync& fence : ring.fences)
+    {
+        if (fence)
+            glCheck(GLEXT_glDeleteSync(fence));
+
+        fence = {};
+    }
+
+#endif
+}
+
+
+// Wait for the GPU to be done with a segment of the ring, the context must be active
+void waitForSegment([[maybe_unused]] sf::priv::VertexBufferRing& ring, [[maybe_unused]] std::size_t segment)
+{
+#ifndef SFML_OPENGL_ES
+
+    GLsync& fence = ring.fences[segment];
+
+    if (!fence)
+        return;
+
+    // Only flush on the first attempt, later attempts just wait for the GPU to catch up
+    GLbitfield flags = GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT;
+    while (glCheck(GLEXT_glClientWaitSync(fence, flags, 1'000'000)) == GLEXT_GL_TIMEOUT_EXPIRED)
+        flags = 0;
+
+    glCheck(GLEXT_glDeleteSync(fence));
+    fence = {};
+
+#endif
+}
+
+
+// Reserve a region of the ring, the ring's buffer must be bound
+std::size_t reserveRegion(sf::priv::VertexBufferRing& ring, std::size_t vertexCount)
+{
+    std::size_t first = ring.head;
+
+    // Regions never straddle two segments, move to the next segment if this one is too full
+    if ((first % ring.capacity) + vertexCount > ring.capacity)
+        first = (first / ring.capacity + 1) * ring.capacity;
+
+    std::size_t segment = first / ring.capacity;
+    if (segment == sf::priv::VertexBufferRing::segmentCount)
+    {
+        segment = 0;
+        first   = 0;
+    }
+
+    if (segment != ring.segment)
+    {
+        if (ring.persistent)
+        {
+            // The regions of the segment being left have been drawn by now,
+            // fence them and make sure that the GPU is done with the next segment
+#ifndef SFML_OPENGL_ES
+            ring.fences[ring.segment] = glCheck(GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+#endif
+            waitForSegment(ring, segment);
+        }
+        else if (segment == 0)
+        {
+            // Orphan the storage when wrapping around, the driver keeps
+            // the previous storage alive until the GPU is done with it
+            glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                       static_cast<GLsizeiptrARB>(sizeof(sf::Vertex) * ring.capacity *
+                                                                  sf::priv::VertexBufferRing::segmentCount),
+                                       nullptr,
+                                       GLEXT_GL_STREAM_DRAW));
+        }
+
+        ring.segment = segment;
+    }
+
+    ring.head = first + vertexCount;
+
+    return first;
+}
 } // namespace VertexBufferImpl
 } // namespace
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+// The ring type is incomplete in the header, so the constructors can't be inlined there
+VertexBuffer::VertexBuffer() = default;
+
+
 ////////////////////////////////////////////////////////////
 VertexBuffer::VertexBuffer(PrimitiveType type) : m_primitiveType(type)
 {
@@ -89,7 +224,7 @@ m_usage(copy.m_usage)
 {
     if (copy.m_buffer && copy.m_size)
     {
-        if (!create(copy.m_size))
+        if (!create(copy.m_ring ? copy.m_ring->capacity : copy.m_size))
         {
             err() << "Could not create vertex buffer for copying" << std::endl;
             return;
@@ -108,6 +243,9 @@ VertexBuffer::~VertexBuffer()
     {
         const TransientContextLock contextLock;
 
+        if (m_ring)
+            VertexBufferImpl::releaseFences(*m_ring);
+
         glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
     }
 }
@@ -121,6 +259,21 @@ bool VertexBuffer::create(std::size_t vertexCount)
 
     const TransientContextLock contextLock;
 
+    // The storage of a streaming buffer may be immutable, start over with a new buffer
+    if (m_ring)
+    {
+        VertexBufferImpl::releaseFences(*m_ring);
+        m_ring.reset();
+
+        if (m_buffer)
+        {
+            glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+            m_buffer = 0;
+        }
+    }
+
+    m_firstVertex = 0;
+
     if (!m_buffer)
         glCheck(GLEXT_glGenBuffers(1, &m_buffer));
 
@@ -131,10 +284,47 @@ bool VertexBuffer::create(std::size_t vertexCount)
     }
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
-    glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                               nullptr,
-                               VertexBufferImpl::usageToGlEnum(m_usage)));
+
+    if ((m_usage == Usage::Streaming) && vertexCount)
+    {
+        m_ring           = std::make_unique<priv::VertexBufferRing>();
+        m_ring->capacity = vertexCount;
+
+        const std::size_t ringSize = vertexCount * priv::VertexBufferRing::segmentCount;
+        const auto        size     = static_cast<GLsizeiptrARB>(sizeof(Vertex) * ringSize);
+
+#ifndef SFML_OPENGL_ES
+        if (VertexBufferImpl::isPersistentMappingAvailable())
+        {
+            // Map the whole ring once and for all, coherent mapping makes writes visible without explicit flushes
+            const GLbitfield flags = GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_PERSISTENT_BIT | GLEXT_GL_MAP_COHERENT_BIT;
+
+            glCheck(GLEXT_glBufferStorage(GLEXT_GL_ARRAY_BUFFER, size, nullptr, flags));
+            void* const data = glCheck(GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER, 0, size, flags));
+            m_ring->persistent = static_cast<Vertex*>(data);
+
+            if (!m_ring->persistent)
+            {
+                err() << "Could not create vertex buffer, persistent mapping failed" << std::endl;
+                glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+                m_ring.reset();
+                return false;
+            }
+        }
+        else
+#endif
+        {
+            glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER, size, nullptr, GLEXT_GL_STREAM_DRAW));
+        }
+    }
+    else
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                   nullptr,
+                                   VertexBufferImpl::usageToGlEnum(m_usage)));
+    }
+
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
     m_size = vertexCount;
@@ -150,6 +340,13 @@ std::size_t VertexBuffer::getVertexCount() const
 }
 
 
+////////////////////////////////////////////////////////////
+std::size_t VertexBuffer::getCapacity() const
+{
+    return m_ring ? m_ring->capacity : m_size;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool VertexBuffer::update(const Vertex* vertices)
 {
@@ -167,6 +364,21 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
     if (!vertices)
         return false;
 
+    // Streaming buffers are always written to a new region of their ring
+    if (m_ring)
+    {
+        if (offset)
+            return false;
+
+        Vertex* const destination = map(vertexCount);
+        if (!destination)
+            return false;
+
+        std::memcpy(destination, vertices, sizeof(Vertex) * vertexCount);
+
+        return unmap();
+    }
+
     if (offset && (offset + vertexCount > m_size))
         return false;
 
@@ -208,20 +420,38 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
     if (!m_buffer || !vertexBuffer.m_buffer)
         return false;
 
+    if (m_ring && (m_ring->mapped || (vertexBuffer.m_size > m_ring->capacity)))
+        return false;
+
     const TransientContextLock contextLock;
 
     // Make sure that extensions are initialized
     priv::ensureExtensionsInit();
 
+    // Streaming buffers only hold their vertices somewhere in their ring
+    const auto readOffset = static_cast<GLintptr>(sizeof(Vertex) * vertexBuffer.m_firstVertex);
+
     if (GLEXT_copy_buffer)
     {
+        std::size_t writeFirst = 0;
+
+        if (m_ring)
+        {
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+            writeFirst = VertexBufferImpl::reserveRegion(*m_ring, vertexBuffer.m_size);
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+            m_firstVertex = writeFirst;
+            m_size        = vertexBuffer.m_size;
+        }
+
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, vertexBuffer.m_buffer));
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, m_buffer));
 
         glCheck(GLEXT_glCopyBufferSubData(GLEXT_GL_COPY_READ_BUFFER,
                                           GLEXT_GL_COPY_WRITE_BUFFER,
-                                          0,
-                                          0,
+                                          readOffset,
+                                          static_cast<GLintptr>(sizeof(Vertex) * writeFirst),
                                           static_cast<GLsizeiptr>(sizeof(Vertex) * vertexBuffer.m_size)));
 
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, 0));
@@ -230,6 +460,10 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
         return true;
     }
 
+    // Without buffer copies, streaming buffers would have to be mapped twice
+    if (m_ring || vertexBuffer.m_ring)
+        return false;
+
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
     glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
                                static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexBuffer.m_size),
@@ -258,6 +492,112 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 }
 
 
+////////////////////////////////////////////////////////////
+Vertex* VertexBuffer::map(std::size_t vertexCount)
+{
+    if (!m_buffer || !m_ring)
+    {
+        err() << "Could not map vertex buffer, it wasn't created with the Streaming usage" << std::endl;
+        return nullptr;
+    }
+
+    priv::VertexBufferRing& ring = *m_ring;
+
+    if (ring.mapped)
+    {
+        err() << "Could not map vertex buffer, it is already mapped" << std::endl;
+        return nullptr;
+    }
+
+    if (!vertexCount || (vertexCount > ring.capacity))
+    {
+        err() << "Could not map vertex buffer, " << vertexCount << " vertices requested but at most " << ring.capacity
+              << " can be mapped at once" << std::endl;
+        return nullptr;
+    }
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    ring.regionFirst = VertexBufferImpl::reserveRegion(ring, vertexCount);
+    ring.regionCount = vertexCount;
+
+    if (ring.persistent)
+    {
+        ring.mapped = ring.persistent + ring.regionFirst;
+    }
+#ifndef SFML_OPENGL_ES
+    else if (GLEXT_map_buffer_range)
+    {
+        // The region was never handed out since the storage was last orphaned, so the GPU can't be using it
+        const GLbitfield access = GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT |
+                                  GLEXT_GL_MAP_UNSYNCHRONIZED_BIT;
+
+        ring.mapped = static_cast<Vertex*>(
+            glCheck(GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER,
+                                           static_cast<GLintptr>(sizeof(Vertex) * ring.regionFirst),
+                                           static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount),
+                                           access)));
+    }
+#endif
+    else
+    {
+        ring.staging.resize(vertexCount);
+        ring.mapped = ring.staging.data();
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    if (!ring.mapped)
+        err() << "Could not map vertex buffer" << std::endl;
+
+    return ring.mapped;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::unmap()
+{
+    if (!m_ring || !m_ring->mapped)
+        return false;
+
+    priv::VertexBufferRing& ring   = *m_ring;
+    bool                    result = true;
+
+    if (!ring.persistent)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+#ifndef SFML_OPENGL_ES
+        if (GLEXT_map_buffer_range)
+        {
+            result = glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER)) == GL_TRUE;
+        }
+        else
+#endif
+        {
+            glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                          static_cast<GLintptrARB>(sizeof(Vertex) * ring.regionFirst),
+                                          static_cast<GLsizeiptrARB>(sizeof(Vertex) * ring.regionCount),
+                                          ring.staging.data()));
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+    }
+
+    ring.mapped = nullptr;
+
+    // The region that was just written becomes the contents of the buffer
+    m_firstVertex = ring.regionFirst;
+    m_size        = ring.regionCount;
+
+    return result;
+}
+
+
 ////////////////////////////////////////////////////////////
 VertexBuffer& VertexBuffer::operator=(const VertexBuffer& right)
 {
@@ -273,6 +613,8 @@ VertexBuffer& VertexBuffer::operator=(const VertexBuffer& right)
 void VertexBuffer::swap(VertexBuffer& right) noexcept
 {
     std::swap(m_size, right.m_size);
+    std::swap(m_firstVertex, right.m_firstVertex);
+    std::swap(m_ring, right.m_ring);
     std::swap(m_buffer, right.m_buffer);
     std::swap(m_primitiveType, right.m_primitiveType);
     std::swap(m_usage, right.m_usage);
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexTransform.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SFML_VERTEX_TRANSFORM_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define SFML_VERTEX_TRANSFORM_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void transformVertices(const Transform& transform, const Vertex* input, Vertex* output, std::size_t count)
+{
+    // The transform is a 4x4 column-major matrix, only its 2D affine part is relevant here:
+    // x' = m[0] * x + m[4] * y + m[12]
+    // y' = m[1] * x + m[5] * y + m[13]
+    [[maybe_unused]] const float* matrix = transform.getMatrix();
+    std::size_t                   i      = 0;
+
+#if defined(SFML_VERTEX_TRANSFORM_SSE2)
+    const __m128 column0     = _mm_setr_ps(matrix[0], matrix[1], matrix[0], matrix[1]);
+    const __m128 column1     = _mm_setr_ps(matrix[4], matrix[5], matrix[4], matrix[5]);
+    const __m128 translation = _mm_setr_ps(matrix[12], matrix[13], matrix[12], matrix[13]);
+
+    // Transform 2 vertices at a time, positions are loaded as {x0, y0, x1, y1}
+    for (; i + 2 <= count; i += 2)
+    {
+        output[i].color         = input[i].color;
+        output[i].texCoords     = input[i].texCoords;
+        output[i + 1].color     = input[i + 1].color;
+        output[i + 1].texCoords = input[i + 1].texCoords;
+
+        const __m128 position = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(),
+                                                          reinterpret_cast<const __m64*>(&input[i].position)),
+                                             reinterpret_cast<const __m64*>(&input[i + 1].position));
+        const __m128 x        = _mm_shuffle_ps(position, position, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 y        = _mm_shuffle_ps(position, position, _MM_SHUFFLE(3, 3, 1, 1));
+        const __m128 result   = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, column0), _mm_mul_ps(y, column1)), translation);
+
+        _mm_storel_pi(reinterpret_cast<__m64*>(&output[i].position), result);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(&output[i + 1].position), result);
+    }
+#elif defined(SFML_VERTEX_TRANSFORM_NEON)
+    const float32x4_t translationX = vdupq_n_f32(matrix[12]);
+    const float32x4_t translationY = vdupq_n_f32(matrix[13]);
+
+    // Transform 4 vertices at a time, positions are gathered as {x0, y0, x1, y1, ...} and deinterleaved on load
+    for (; i + 4 <= count; i += 4)
+    {
+        float positions[8];
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            output[i + j].color     = input[i + j].color;
+            output[i + j].texCoords = input[i + j].texCoords;
+            positions[j * 2]        = input[i + j].position.x;
+            positions[j * 2 + 1]    = input[i + j].position.y;
+        }
+
+        const float32x4x2_t position = vld2q_f32(positions);
+        float32x4x2_t       result;
+        result.val[0] = vmlaq_n_f32(vmlaq_n_f32(translationX, position.val[0], matrix[0]), position.val[1], matrix[4]);
+        result.val[1] = vmlaq_n_f32(vmlaq_n_f32(translationY, position.val[0], matrix[1]), position.val[1], matrix[5]);
+        vst2q_f32(positions, result);
+
+        for (std::size_t j = 0; j < 4; ++j)
+            output[i + j].position = {positions[j * 2], positions[j * 2 + 1]};
+    }
+#endif
+
+    // Transform the remaining vertices one by one
+    transformVerticesScalar(transform, input + i, output + i, count - i);
+}
+
+
+////////////////////////////////////////////////////////////
+void transformVerticesScalar(const Transform& transform, const Vertex* input, Vertex* output, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        output[i].color     = input[i].color;
+        output[i].texCoords = input[i].texCoords;
+        output[i].position  = transform.transformPoint(input[i].position);
+    }
+}
+
+} // namespace sf::priv
@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+
+
+namespace sf
+{
+class Transform;
+struct Vertex;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Transform the positions of an array of vertices
+///
+/// Colors and texture coordinates are copied unchanged.
+/// This function uses SSE2 or NEON instructions to transform
+/// several vertices at once when they are available, and
+/// falls back to `transformVerticesScalar` otherwise.
+///
+/// `input` and `output` may point to the same array, but
+/// must not partially overlap.
+///
+/// \param transform Transform to apply
+/// \param input     Pointer to the vertices to transform
+/// \param output    Pointer to the array receiving the transformed vertices
+/// \param count     Number of vertices to transform
+///
+////////////////////////////////////////////////////////////
+void transformVertices(const Transform& transform, const Vertex* input, Vertex* output, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Transform the positions of an array of vertices, one at a time
+///
+/// This is the portable reference implementation of `transformVertices`.
+///
+/// \param transform Transform to apply
+/// \param input     Pointer to the vertices to transform
+/// \param output    Pointer to the array receiving the transformed vertices
+/// \param count     Number of vertices to transform
+///
+////////////////////////////////////////////////////////////
+void transformVerticesScalar(const Transform& transform, const Vertex* input, Vertex* output, std::size_t count);
+
+} // namespace priv
+
+} // namespace sf
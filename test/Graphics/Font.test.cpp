@@ -1,6 +1,7 @@
 #include <SFML/Graphics/Font.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include <SFML/System/Exception.hpp>
@@ -11,7 +12,12 @@
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::Font", runDisplayTests())
 {
@@ -258,4 +264,375 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
         font.setSmooth(false);
         CHECK(!font.isSmooth());
     }
+
+    SECTION("Set/get packing algorithm")
+    {
+        sf::Font font;
+        CHECK(font.getPackingAlgorithm() == sf::Font::PackingAlgorithm::Skyline);
+        font.setPackingAlgorithm(sf::Font::PackingAlgorithm::Rows);
+        CHECK(font.getPackingAlgorithm() == sf::Font::PackingAlgorithm::Rows);
+    }
+
+    SECTION("Set/get rasterization threads")
+    {
+        sf::Font font;
+        CHECK(font.getRasterizationThreads() == 1);
+        font.setRasterizationThreads(4);
+        CHECK(font.getRasterizationThreads() == 4);
+        font.setRasterizationThreads(0);
+        CHECK(font.getRasterizationThreads() == 1);
+    }
+
+    SECTION("Set/get glyph mode")
+    {
+        sf::Font font;
+        CHECK(font.getGlyphMode() == sf::Font::GlyphMode::Bitmap);
+        font.setGlyphMode(sf::Font::GlyphMode::SignedDistanceField);
+        CHECK(font.getGlyphMode() == sf::Font::GlyphMode::SignedDistanceField);
+    }
+
+    SECTION("Set/get memory budget")
+    {
+        sf::Font font;
+        CHECK(font.getMemoryBudget() == 0);
+        font.setMemoryBudget(1024 * 1024);
+        CHECK(font.getMemoryBudget() == 1024 * 1024);
+    }
+
+    SECTION("getCacheStatistics()")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+
+        sf::Font::CacheStatistics statistics = font.getCacheStatistics();
+        CHECK(statistics.hits == 0);
+        CHECK(statistics.misses == 0);
+        CHECK(statistics.evictions == 0);
+        CHECK(statistics.residentBytes == 0);
+
+        (void)font.getGlyph(U'A', 16, false);
+        (void)font.getGlyph(U'A', 16, false);
+        statistics = font.getCacheStatistics();
+        CHECK(statistics.hits == 1);
+        CHECK(statistics.misses == 1);
+        CHECK(statistics.evictions == 0);
+        CHECK(statistics.residentBytes == 128 * 128 * 4);
+    }
+
+    SECTION("Cached kerning")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+
+        const float kerning = font.getKerning(U'A', U'V', 24);
+        CHECK(kerning < 0);
+        const sf::Font::CacheStatistics statistics = font.getCacheStatistics();
+
+        // Pairs already seen don't look up their glyphs again
+        CHECK(font.getKerning(U'A', U'V', 24) == kerning);
+        CHECK(font.getCacheStatistics().hits == statistics.hits);
+        CHECK(font.getCacheStatistics().misses == statistics.misses);
+
+        // Cached values are the ones fonts that never saw the pairs compute, for each size and boldness
+        const auto uncachedKerning = [](unsigned int characterSize, bool bold)
+        { return sf::Font("Graphics/tuffy.ttf").getKerning(U'A', U'V', characterSize, bold); };
+        CHECK(font.getKerning(U'A', U'V', 48) < kerning);
+        CHECK(font.getKerning(U'A', U'V', 48) == uncachedKerning(48, false));
+        CHECK(font.getKerning(U'A', U'V', 24, true) == uncachedKerning(24, true));
+        CHECK(font.getKerning(U'A', U'V', 24, true) == uncachedKerning(24, true));
+        CHECK(font.getKerning(U'A', U'V', 24) == uncachedKerning(24, false));
+    }
+
+    SECTION("Save/load atlas")
+    {
+        const auto filename = std::filesystem::temp_directory_path() / "sfml-font-atlas.bin";
+
+        sf::Glyph    glyph;
+        sf::Vector2u textureSize;
+        {
+            const sf::Font font("Graphics/tuffy.ttf");
+            glyph = font.getGlyph(U'A', 24, false);
+            (void)font.getGlyph(U'B', 24, false, 1.f);
+            textureSize = font.getTexture(24).getSize();
+            REQUIRE(font.saveAtlasToFile(filename));
+        }
+
+        sf::Font font("Graphics/tuffy.ttf");
+        REQUIRE(font.loadAtlasFromFile(filename));
+        CHECK(font.getCacheStatistics().residentBytes == std::size_t{textureSize.x} * textureSize.y * 4);
+        CHECK(font.getTexture(24).getSize() == textureSize);
+
+        // Baked glyphs are found in the cache, the other ones are still rasterized
+        const sf::Glyph& loadedGlyph = font.getGlyph(U'A', 24, false);
+        CHECK(loadedGlyph.advance == glyph.advance);
+        CHECK(loadedGlyph.bounds == glyph.bounds);
+        CHECK(loadedGlyph.textureRect == glyph.textureRect);
+        (void)font.getGlyph(U'B', 24, false, 1.f);
+        CHECK(font.getCacheStatistics().hits == 2);
+        CHECK(font.getCacheStatistics().misses == 0);
+
+        (void)font.getGlyph(U'C', 24, false);
+        CHECK(font.getCacheStatistics().misses == 1);
+        CHECK(font.getTexture(24).getSize() == textureSize);
+
+        // The atlas only fits an open font, and other files are rejected
+        sf::Font emptyFont;
+        CHECK(!emptyFont.loadAtlasFromFile(filename));
+        CHECK(!font.loadAtlasFromFile("Graphics/tuffy.ttf"));
+
+        // Truncated and out of range atlases are rejected without changing the pages
+        std::vector<char> bytes(static_cast<std::size_t>(std::filesystem::file_size(filename)));
+        {
+            std::ifstream file(filename, std::ios::binary);
+            REQUIRE(file.read(bytes.data(), static_cast<std::streamsize>(bytes.size())));
+        }
+
+        const auto writeAtlas = [&filename](const std::vector<char>& data)
+        {
+            std::ofstream file(filename, std::ios::binary);
+            REQUIRE(file.write(data.data(), static_cast<std::streamsize>(data.size())));
+        };
+
+        writeAtlas(std::vector<char>(bytes.begin(), bytes.end() - 1));
+        CHECK(!font.loadAtlasFromFile(filename));
+
+        // The height of the texture rectangle of the last glyph is stored right before the alpha channel of the page
+        std::vector<char> outOfRangeBytes = bytes;
+        outOfRangeBytes[bytes.size() - std::size_t{textureSize.x} * textureSize.y - 1] = 0x7F;
+        writeAtlas(outOfRangeBytes);
+        CHECK(!font.loadAtlasFromFile(filename));
+
+        (void)font.getGlyph(U'C', 24, false);
+        CHECK(font.getCacheStatistics().misses == 1);
+        CHECK(font.getTexture(24).getSize() == textureSize);
+
+        CHECK(std::filesystem::remove(filename));
+    }
+
+    SECTION("Memory budget")
+    {
+        constexpr std::size_t pageBytes = 128 * 128 * 4;
+
+        sf::Font font("Graphics/tuffy.ttf");
+
+        SECTION("Least recently used pages are evicted")
+        {
+            font.setMemoryBudget(2 * pageBytes);
+
+            (void)font.getGlyph(U'A', 10, false);
+            (void)font.getGlyph(U'A', 11, false);
+            (void)font.getGlyph(U'B', 10, false);
+            (void)font.getGlyph(U'A', 12, false);
+
+            // The page of size 11 was the least recently used one
+            sf::Font::CacheStatistics statistics = font.getCacheStatistics();
+            CHECK(statistics.evictions == 1);
+            CHECK(statistics.residentBytes == 2 * pageBytes);
+            CHECK(font.getPageStatistics(10).glyphCount == 2);
+
+            // Lowering the budget applies immediately, the page of size 12 is now the least recently used one
+            font.setMemoryBudget(pageBytes);
+            statistics = font.getCacheStatistics();
+            CHECK(statistics.evictions == 2);
+            CHECK(statistics.residentBytes == pageBytes);
+            CHECK(font.getPageStatistics(10).glyphCount == 2);
+        }
+
+        SECTION("Pages that can't grow are packed again")
+        {
+            font.setMemoryBudget(pageBytes);
+
+            for (char32_t codePoint = 0x21; codePoint <= 0x7E; ++codePoint)
+            {
+                // Every glyph still gets a place in the texture
+                CHECK(font.getGlyph(codePoint, 40, false).textureRect.size.x > 0);
+            }
+
+            const sf::Font::CacheStatistics statistics = font.getCacheStatistics();
+            CHECK(statistics.evictions > 0);
+            CHECK(statistics.residentBytes == pageBytes);
+            CHECK(font.getTexture(40).getSize() == sf::Vector2u(128, 128));
+        }
+    }
+
+    SECTION("getPageStatistics()")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        font.setPackingAlgorithm(GENERATE(sf::Font::PackingAlgorithm::Rows, sf::Font::PackingAlgorithm::Skyline));
+
+        sf::Font::PageStatistics statistics = font.getPageStatistics(16);
+        CHECK(statistics.textureSize == sf::Vector2u(128, 128));
+        CHECK(statistics.glyphCount == 0);
+        CHECK(statistics.usedArea == 0);
+        CHECK(statistics.occupancy == 0);
+        CHECK(statistics.textureResizes == 0);
+
+        // The glyph is 8x12 pixels, plus 2 pixels of padding on each side
+        CHECK(font.getGlyph(0x45, 16, false).textureRect == sf::IntRect({2, 5}, {8, 12}));
+        statistics = font.getPageStatistics(16);
+        CHECK(statistics.glyphCount == 1);
+        CHECK(statistics.usedArea == 12 * 16);
+        CHECK(statistics.occupancy == Approx(12.f * 16.f / (128.f * 128.f)));
+        CHECK(statistics.textureResizes == 0);
+    }
+
+    SECTION("preloadGlyphs()")
+    {
+        sf::Font preloadedFont("Graphics/tuffy.ttf");
+        sf::Font font("Graphics/tuffy.ttf");
+
+        // Enough glyphs to enlarge the page texture while they are being staged
+        preloadedFont.preloadGlyphs(U"SFML", 40, false, 2);
+        preloadedFont.preloadGlyphs(0x21, 0x7E, 40, false, 2);
+        CHECK(preloadedFont.getPageStatistics(40).textureResizes > 0);
+
+        for (const char32_t codePoint : std::u32string_view(U"SFML"))
+            (void)font.getGlyph(codePoint, 40, false, 2);
+        for (char32_t codePoint = 0x21; codePoint <= 0x7E; ++codePoint)
+            (void)font.getGlyph(codePoint, 40, false, 2);
+
+        // Preloaded glyphs are already in the cache and end up at the same place in the texture
+        const sf::Font::PageStatistics statistics = preloadedFont.getPageStatistics(40);
+        CHECK(statistics.glyphCount == font.getPageStatistics(40).glyphCount);
+        for (char32_t codePoint = 0x21; codePoint <= 0x7E; ++codePoint)
+            CHECK(preloadedFont.getGlyph(codePoint, 40, false, 2).textureRect ==
+                  font.getGlyph(codePoint, 40, false, 2).textureRect);
+        CHECK(preloadedFont.getPageStatistics(40).glyphCount == statistics.glyphCount);
+
+        const sf::Image preloadedImage = preloadedFont.getTexture(40).copyToImage();
+        const sf::Image image          = font.getTexture(40).copyToImage();
+        bool            samePixels     = true;
+        for (char32_t codePoint = 0x21; codePoint <= 0x7E; ++codePoint)
+        {
+            const sf::Rect<unsigned int> rect(font.getGlyph(codePoint, 40, false, 2).textureRect);
+            for (unsigned int y = rect.position.y; y < rect.position.y + rect.size.y; ++y)
+                for (unsigned int x = rect.position.x; x < rect.position.x + rect.size.x; ++x)
+                    samePixels = samePixels && (preloadedImage.getPixel({x, y}) == image.getPixel({x, y}));
+        }
+        CHECK(samePixels);
+    }
+
+    SECTION("preloadGlyphs() with several rasterization threads")
+    {
+        sf::Font threadedFont("Graphics/tuffy.ttf");
+        sf::Font font("Graphics/tuffy.ttf");
+        threadedFont.setRasterizationThreads(4);
+
+        threadedFont.preloadGlyphs(0x20, 0x17F, 24, true, 1);
+        font.preloadGlyphs(0x20, 0x17F, 24, true, 1);
+
+        // Each lookup is counted once, whichever thread rasterized the glyph
+        CHECK(threadedFont.getCacheStatistics().hits == font.getCacheStatistics().hits);
+        CHECK(threadedFont.getCacheStatistics().misses == font.getCacheStatistics().misses);
+        CHECK(threadedFont.getCacheStatistics().hits + threadedFont.getCacheStatistics().misses == 0x17F - 0x20 + 1);
+
+        // Glyphs rasterized concurrently are packed in the same order as with a single thread
+        CHECK(threadedFont.getPageStatistics(24).glyphCount == font.getPageStatistics(24).glyphCount);
+        REQUIRE(threadedFont.getTexture(24).getSize() == font.getTexture(24).getSize());
+
+        const sf::Image threadedImage = threadedFont.getTexture(24).copyToImage();
+        const sf::Image image         = font.getTexture(24).copyToImage();
+        bool            sameGlyphs    = true;
+        for (char32_t codePoint = 0x20; codePoint <= 0x17F; ++codePoint)
+        {
+            const sf::Glyph& threadedGlyph = threadedFont.getGlyph(codePoint, 24, true, 1);
+            const sf::Glyph& glyph         = font.getGlyph(codePoint, 24, true, 1);
+            sameGlyphs = sameGlyphs && (threadedGlyph.advance == glyph.advance) && (threadedGlyph.bounds == glyph.bounds) &&
+                         (threadedGlyph.textureRect == glyph.textureRect);
+        }
+        CHECK(sameGlyphs);
+        CHECK(std::equal(threadedImage.getPixelsPtr(),
+                         threadedImage.getPixelsPtr() + threadedImage.getSize().x * threadedImage.getSize().y * 4,
+                         image.getPixelsPtr()));
+    }
+
+    SECTION("Signed distance field glyphs")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        font.setGlyphMode(sf::Font::GlyphMode::SignedDistanceField);
+
+        // All the character sizes share the glyphs rasterized at the reference size
+        CHECK(&font.getTexture(16) == &font.getTexture(64));
+        const sf::Glyph& smallGlyph = font.getGlyph(U'A', 16, false);
+        const sf::Glyph& largeGlyph = font.getGlyph(U'A', 64, false);
+        CHECK(smallGlyph.textureRect == largeGlyph.textureRect);
+        CHECK(smallGlyph.advance == Approx(largeGlyph.advance / 4));
+        CHECK(smallGlyph.bounds.size.x == Approx(largeGlyph.bounds.size.x / 4));
+        CHECK(smallGlyph.bounds.size.y == Approx(largeGlyph.bounds.size.y / 4));
+        CHECK(font.getPageStatistics(16).glyphCount == 1);
+
+        // Outlines cover the part of the distance field they spread over
+        const sf::Glyph& outlineGlyph = font.getGlyph(U'A', 16, false, 1);
+        CHECK(outlineGlyph.textureRect ==
+              sf::IntRect(largeGlyph.textureRect.position - sf::Vector2i(4, 4), largeGlyph.textureRect.size + sf::Vector2i(8, 8)));
+        CHECK(font.getPageStatistics(16).glyphCount == 1);
+
+        // The edge of the distance field matches the glyph rasterized as a bitmap at the reference size
+        const sf::Font   bitmapFont("Graphics/tuffy.ttf");
+        const sf::Glyph& bitmapGlyph = bitmapFont.getGlyph(U'A', 64, false);
+        CHECK(largeGlyph.bounds == bitmapGlyph.bounds);
+        REQUIRE(largeGlyph.textureRect.size == bitmapGlyph.textureRect.size);
+
+        const sf::Image fieldImage  = font.getTexture(64).copyToImage();
+        const sf::Image bitmapImage = bitmapFont.getTexture(64).copyToImage();
+        bool            sameEdges   = true;
+        for (int y = 0; y < largeGlyph.textureRect.size.y; ++y)
+        {
+            for (int x = 0; x < largeGlyph.textureRect.size.x; ++x)
+            {
+                const auto fieldPixel  = sf::Vector2u(largeGlyph.textureRect.position + sf::Vector2i(x, y));
+                const auto bitmapPixel = sf::Vector2u(bitmapGlyph.textureRect.position + sf::Vector2i(x, y));
+                sameEdges = sameEdges && ((fieldImage.getPixel(fieldPixel).a >= 128) == (bitmapImage.getPixel(bitmapPixel).a >= 128));
+            }
+        }
+        CHECK(sameEdges);
+        CHECK(fieldImage.getPixel(sf::Vector2u(largeGlyph.textureRect.position - sf::Vector2i(8, 8))).a == 0);
+
+        // Bitmap pages are kept separately
+        font.setGlyphMode(sf::Font::GlyphMode::Bitmap);
+        CHECK(&font.getTexture(16) != &font.getTexture(64));
+        CHECK(font.getGlyph(U'A', 64, false).textureRect == bitmapGlyph.textureRect);
+    }
+
+    SECTION("Signed distance field page stays smooth when it grows")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        font.setSmooth(false);
+        font.setGlyphMode(sf::Font::GlyphMode::SignedDistanceField);
+
+        const sf::Vector2u initialSize = font.getTexture(16).getSize();
+        for (char32_t codePoint = U'A'; codePoint <= U'z'; ++codePoint)
+            (void)font.getGlyph(codePoint, 16, false);
+
+        REQUIRE(font.getTexture(16).getSize() != initialSize);
+        CHECK(font.getTexture(16).isSmooth());
+    }
+
+    SECTION("Glyph packing")
+    {
+        sf::Font rowFont("Graphics/tuffy.ttf");
+        rowFont.setPackingAlgorithm(sf::Font::PackingAlgorithm::Rows);
+        sf::Font skylineFont("Graphics/tuffy.ttf");
+
+        // Outlines of different thicknesses give glyphs of very different sizes on the same page
+        std::vector<sf::IntRect> rects;
+        for (const float outlineThickness : {0.f, 2.f, 6.f})
+        {
+            for (char32_t codePoint = 0x21; codePoint < 0x7F; ++codePoint)
+            {
+                (void)rowFont.getGlyph(codePoint, 40, false, outlineThickness);
+                rects.push_back(skylineFont.getGlyph(codePoint, 40, false, outlineThickness).textureRect);
+            }
+        }
+
+        const sf::Font::PageStatistics rowStatistics     = rowFont.getPageStatistics(40);
+        const sf::Font::PageStatistics skylineStatistics = skylineFont.getPageStatistics(40);
+        CHECK(skylineStatistics.glyphCount == rowStatistics.glyphCount);
+        CHECK(skylineStatistics.usedArea == rowStatistics.usedArea);
+        CHECK(skylineStatistics.textureResizes <= rowStatistics.textureResizes);
+        CHECK(skylineStatistics.occupancy >= rowStatistics.occupancy);
+
+        // Glyphs must not overlap each other
+        for (std::size_t i = 0; i < rects.size(); ++i)
+            for (std::size_t j = i + 1; j < rects.size(); ++j)
+                CHECK(!rects[i].findIntersection(rects[j]));
+    }
 }
@@ -0,0 +1,184 @@
+#include <SFML/Graphics/IndexBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <array>
+#include <type_traits>
+
+#include <cstdint>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::IndexBuffer", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::IndexBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::IndexBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_nothrow_swappable_v<sf::IndexBuffer>);
+    }
+
+    // Skip tests if index buffers aren't available
+    if (!sf::IndexBuffer::isAvailable())
+        return;
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::IndexBuffer indexBuffer;
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getNativeHandle() == 0);
+            CHECK(indexBuffer.getType() == sf::IndexBuffer::Type::UInt16);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Stream);
+        }
+
+        SECTION("Type constructor")
+        {
+            const sf::IndexBuffer indexBuffer(sf::IndexBuffer::Type::UInt32);
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getNativeHandle() == 0);
+            CHECK(indexBuffer.getType() == sf::IndexBuffer::Type::UInt32);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Stream);
+        }
+
+        SECTION("Usage constructor")
+        {
+            const sf::IndexBuffer indexBuffer(sf::IndexBuffer::Usage::Static);
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getNativeHandle() == 0);
+            CHECK(indexBuffer.getType() == sf::IndexBuffer::Type::UInt16);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Static);
+        }
+
+        SECTION("Type and usage constructor")
+        {
+            const sf::IndexBuffer indexBuffer(sf::IndexBuffer::Type::UInt32, sf::IndexBuffer::Usage::Dynamic);
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getNativeHandle() == 0);
+            CHECK(indexBuffer.getType() == sf::IndexBuffer::Type::UInt32);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+        }
+    }
+
+    SECTION("Copy semantics")
+    {
+        sf::IndexBuffer indexBuffer(sf::IndexBuffer::Type::UInt32, sf::IndexBuffer::Usage::Dynamic);
+        CHECK(indexBuffer.create(10));
+
+        SECTION("Construction")
+        {
+            const sf::IndexBuffer indexBufferCopy(indexBuffer); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(indexBufferCopy.getIndexCount() == 10);
+            CHECK(indexBufferCopy.getNativeHandle() != 0);
+            CHECK(indexBufferCopy.getNativeHandle() != indexBuffer.getNativeHandle());
+            CHECK(indexBufferCopy.getType() == sf::IndexBuffer::Type::UInt32);
+            CHECK(indexBufferCopy.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+        }
+
+        SECTION("Assignment")
+        {
+            sf::IndexBuffer indexBufferCopy;
+            indexBufferCopy = indexBuffer;
+            CHECK(indexBufferCopy.getIndexCount() == 10);
+            CHECK(indexBufferCopy.getNativeHandle() != 0);
+            CHECK(indexBufferCopy.getType() == sf::IndexBuffer::Type::UInt32);
+            CHECK(indexBufferCopy.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+        }
+    }
+
+    SECTION("create()")
+    {
+        sf::IndexBuffer indexBuffer;
+        CHECK(indexBuffer.create(100));
+        CHECK(indexBuffer.getIndexCount() == 100);
+    }
+
+    SECTION("update()")
+    {
+        SECTION("16-bit indices")
+        {
+            sf::IndexBuffer                     indexBuffer(sf::IndexBuffer::Type::UInt16);
+            std::array<std::uint16_t, 96>       indices{};
+            const std::array<std::uint32_t, 96> wrongIndices{};
+
+            SECTION("Uninitialized buffer")
+            {
+                CHECK(!indexBuffer.update(indices.data()));
+            }
+
+            CHECK(indexBuffer.create(96));
+
+            SECTION("Null indices")
+            {
+                CHECK(!indexBuffer.update(static_cast<const std::uint16_t*>(nullptr)));
+            }
+
+            SECTION("Count + offset too large")
+            {
+                CHECK(!indexBuffer.update(indices.data(), 60, 60));
+            }
+
+            CHECK(!indexBuffer.update(wrongIndices.data()));
+            CHECK(indexBuffer.update(indices.data()));
+            CHECK(indexBuffer.update(indices.data(), 32, 64));
+            CHECK(indexBuffer.getIndexCount() == 96);
+            CHECK(indexBuffer.getNativeHandle() != 0);
+        }
+
+        SECTION("32-bit indices")
+        {
+            sf::IndexBuffer                     indexBuffer(sf::IndexBuffer::Type::UInt32);
+            std::array<std::uint32_t, 96>       indices{};
+            const std::array<std::uint16_t, 96> wrongIndices{};
+
+            CHECK(indexBuffer.create(96));
+            CHECK(!indexBuffer.update(wrongIndices.data()));
+            CHECK(indexBuffer.update(indices.data()));
+            CHECK(indexBuffer.getIndexCount() == 96);
+        }
+
+        SECTION("Another buffer")
+        {
+            sf::IndexBuffer indexBuffer;
+            sf::IndexBuffer otherIndexBuffer(sf::IndexBuffer::Type::UInt32);
+
+            CHECK(!indexBuffer.update(otherIndexBuffer));
+            CHECK(indexBuffer.create(42));
+            CHECK(otherIndexBuffer.create(42));
+            CHECK(!indexBuffer.update(otherIndexBuffer));
+        }
+    }
+
+    SECTION("swap()")
+    {
+        sf::IndexBuffer indexBuffer1(sf::IndexBuffer::Type::UInt16, sf::IndexBuffer::Usage::Dynamic);
+        CHECK(indexBuffer1.create(50));
+
+        sf::IndexBuffer indexBuffer2(sf::IndexBuffer::Type::UInt32, sf::IndexBuffer::Usage::Static);
+        CHECK(indexBuffer2.create(60));
+
+        sf::swap(indexBuffer1, indexBuffer2);
+
+        CHECK(indexBuffer1.getIndexCount() == 60);
+        CHECK(indexBuffer1.getNativeHandle() != 0);
+        CHECK(indexBuffer1.getType() == sf::IndexBuffer::Type::UInt32);
+        CHECK(indexBuffer1.getUsage() == sf::IndexBuffer::Usage::Static);
+
+        CHECK(indexBuffer2.getIndexCount() == 50);
+        CHECK(indexBuffer2.getNativeHandle() != 0);
+        CHECK(indexBuffer2.getType() == sf::IndexBuffer::Type::UInt16);
+        CHECK(indexBuffer2.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+    }
+
+    SECTION("Set/get usage")
+    {
+        sf::IndexBuffer indexBuffer;
+        indexBuffer.setUsage(sf::IndexBuffer::Usage::Dynamic);
+        CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+    }
+}
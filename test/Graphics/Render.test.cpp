@@ -1,12 +1,29 @@
+#include <SFML/Graphics/CircleShape.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/InstanceBuffer.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderCommandList.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
 
+#include <SFML/System/Sleep.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
 
 TEST_CASE("[Graphics] Render Tests", runDisplayTests())
 {
@@ -237,4 +254,548 @@ TEST_CASE("[Graphics] Render Tests", runDisplayTests())
             }
         }
     }
+
+    SECTION("Batching")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.setBatchingEnabled(true);
+        renderTexture.clear(sf::Color::Red);
+
+        sf::RectangleShape shape1({50, 100});
+        shape1.setFillColor(sf::Color::Green);
+        sf::RectangleShape shape2({50, 100});
+        shape2.setFillColor(sf::Color::Blue);
+        shape2.setPosition({50, 0});
+
+        renderTexture.draw(shape1);
+        renderTexture.draw(shape2);
+        CHECK(renderTexture.getStatistics().submittedDraws == 2);
+        CHECK(renderTexture.getStatistics().mergedDraws == 1);
+        CHECK(renderTexture.getStatistics().flushedBatches == 0);
+
+        renderTexture.display();
+        CHECK(renderTexture.getStatistics().flushedBatches == 1);
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 50}) == sf::Color::Blue);
+
+        // The next frame is counted from zero
+        renderTexture.draw(shape1);
+        CHECK(renderTexture.getStatistics().submittedDraws == 1);
+        CHECK(renderTexture.getStatistics().mergedDraws == 0);
+        CHECK(renderTexture.getStatistics().flushedBatches == 0);
+
+        renderTexture.resetStatistics();
+        CHECK(renderTexture.getStatistics().submittedDraws == 0);
+        CHECK(renderTexture.getStatistics().mergedDraws == 0);
+        CHECK(renderTexture.getStatistics().flushedBatches == 0);
+    }
+
+    SECTION("Deferred drawing")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.setDeferredDrawingEnabled(true);
+        renderTexture.clear(sf::Color::Red);
+
+        const auto drawQuad = [&renderTexture](sf::Vector2f position, sf::Color color, const sf::BlendMode& blendMode)
+        {
+            sf::RectangleShape quad({50, 50});
+            quad.setPosition(position);
+            quad.setFillColor(color);
+            renderTexture.draw(quad, blendMode);
+        };
+
+        SECTION("Draws are sorted by states")
+        {
+            drawQuad({0, 0}, sf::Color::Green, sf::BlendAlpha);
+            drawQuad({50, 0}, sf::Color::Blue, sf::BlendNone);
+            drawQuad({0, 50}, sf::Color::Green, sf::BlendAlpha);
+            drawQuad({50, 50}, sf::Color::Blue, sf::BlendNone);
+            renderTexture.display();
+            CHECK(renderTexture.getStatistics().flushedBatches == 2);
+
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({25, 25}) == sf::Color::Green);
+            CHECK(image.getPixel({75, 25}) == sf::Color::Blue);
+            CHECK(image.getPixel({25, 75}) == sf::Color::Green);
+            CHECK(image.getPixel({75, 75}) == sf::Color::Blue);
+        }
+
+        SECTION("Overlapping draws keep their order")
+        {
+            drawQuad({25, 25}, sf::Color::Green, sf::BlendAlpha);
+            drawQuad({25, 25}, sf::Color::Blue, sf::BlendNone);
+            drawQuad({25, 25}, sf::Color::White, sf::BlendAlpha);
+            renderTexture.display();
+            CHECK(renderTexture.getStatistics().flushedBatches == 3);
+            CHECK(renderTexture.getTexture().copyToImage().getPixel({50, 50}) == sf::Color::White);
+        }
+
+        SECTION("Large draws keep their order")
+        {
+            sf::RectangleShape background({1000, 1000});
+            background.setPosition({-500, -500});
+            background.setFillColor(sf::Color::Green);
+
+            drawQuad({25, 25}, sf::Color::Blue, sf::BlendNone);
+            renderTexture.draw(background, sf::BlendAlpha);
+            drawQuad({25, 25}, sf::Color::White, sf::BlendNone);
+            renderTexture.display();
+            CHECK(renderTexture.getStatistics().flushedBatches == 3);
+
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({50, 50}) == sf::Color::White);
+            CHECK(image.getPixel({10, 10}) == sf::Color::Green);
+        }
+
+        SECTION("Layers are drawn in order")
+        {
+            renderTexture.setDrawLayer(1);
+            drawQuad({25, 25}, sf::Color::Green, sf::BlendAlpha);
+            renderTexture.setDrawLayer(0);
+            drawQuad({25, 25}, sf::Color::Blue, sf::BlendAlpha);
+            renderTexture.display();
+            CHECK(renderTexture.getTexture().copyToImage().getPixel({50, 50}) == sf::Color::Green);
+        }
+    }
+
+    SECTION("Statistics")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        // A quad fits in the vertex cache, a 64 point circle doesn't
+        const std::array quad = {sf::Vertex{{0, 0}}, sf::Vertex{{50, 0}}, sf::Vertex{{0, 50}}, sf::Vertex{{50, 50}}};
+        sf::CircleShape  circle(25, 64);
+        circle.setPosition({50, 50});
+
+        renderTexture.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip);
+        renderTexture.draw(circle);
+
+        const sf::RenderTarget::Statistics& statistics = renderTexture.getStatistics();
+#ifdef SFML_ENABLE_RENDER_STATISTICS
+        CHECK(statistics.drawCalls == 2);
+        CHECK(statistics.vertices == 4 + 66);
+        CHECK(statistics.vertexCacheHits == 1);
+        CHECK(statistics.viewChanges >= 1);
+        CHECK(statistics.blendModeChanges >= 1);
+        CHECK(statistics.transformChanges >= 1);
+#else
+        CHECK(statistics.drawCalls == 0);
+        CHECK(statistics.vertices == 0);
+#endif
+
+        renderTexture.resetStatistics();
+        CHECK(statistics.drawCalls == 0);
+        CHECK(statistics.vertices == 0);
+        CHECK(statistics.vertexCacheHits == 0);
+    }
+
+    SECTION("Profile scopes")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+
+        renderTexture.beginProfileScope("frame");
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.beginProfileScope("world");
+        renderTexture.draw(sf::RectangleShape({50, 50}));
+        renderTexture.endProfileScope();
+        renderTexture.endProfileScope();
+        renderTexture.display();
+
+        // Reading the pixels back makes sure the GPU went through the scopes
+        (void)renderTexture.getTexture().copyToImage();
+
+        std::vector<sf::RenderTarget::ProfileResult> results;
+        for (int attempt = 0; (attempt < 1000) && (results.size() < 2); ++attempt)
+        {
+            for (auto& result : renderTexture.getProfileResults())
+                results.push_back(std::move(result));
+
+            if (results.size() < 2)
+                sf::sleep(sf::milliseconds(1));
+        }
+
+        REQUIRE(results.size() == 2);
+        CHECK(results[0].name == "frame");
+        CHECK(results[0].depth == 0);
+        CHECK(results[0].start == sf::Time::Zero);
+        CHECK(results[1].name == "world");
+        CHECK(results[1].depth == 1);
+        CHECK(results[1].start >= results[0].start);
+        CHECK(results[1].duration <= results[0].duration);
+        CHECK(renderTexture.getProfileResults().empty());
+    }
+
+    SECTION("Unbalanced profile scopes")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+
+        // A scope left open must not block the results of the following ones
+        renderTexture.beginProfileScope("unbalanced");
+        renderTexture.beginProfileScope("first");
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.endProfileScope();
+        renderTexture.display();
+
+        renderTexture.beginProfileScope("second");
+        renderTexture.clear(sf::Color::Blue);
+        renderTexture.endProfileScope();
+        renderTexture.display();
+
+        (void)renderTexture.getTexture().copyToImage();
+
+        std::vector<sf::RenderTarget::ProfileResult> results;
+        for (int attempt = 0; (attempt < 1000) && (results.size() < 2); ++attempt)
+        {
+            for (auto& result : renderTexture.getProfileResults())
+                results.push_back(std::move(result));
+
+            if (results.size() < 2)
+                sf::sleep(sf::milliseconds(1));
+        }
+
+        REQUIRE(results.size() == 2);
+        CHECK(results[0].name == "first");
+        CHECK(results[1].name == "second");
+        CHECK(results[1].depth == 0);
+    }
+
+    SECTION("Uncollected profile scopes")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+
+        // Scopes whose results are never collected are dropped, oldest first
+        for (int frame = 0; frame < 100; ++frame)
+        {
+            for (int scope = 0; scope < 50; ++scope)
+            {
+                renderTexture.beginProfileScope("old");
+                renderTexture.endProfileScope();
+            }
+
+            renderTexture.display();
+        }
+
+        renderTexture.beginProfileScope("last");
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.endProfileScope();
+        renderTexture.display();
+
+        (void)renderTexture.getTexture().copyToImage();
+
+        std::vector<sf::RenderTarget::ProfileResult> results;
+        for (int attempt = 0; (attempt < 1000) && (results.empty() || (results.back().name != "last")); ++attempt)
+        {
+            for (auto& result : renderTexture.getProfileResults())
+                results.push_back(std::move(result));
+
+            if (results.empty() || (results.back().name != "last"))
+                sf::sleep(sf::milliseconds(1));
+        }
+
+        REQUIRE(!results.empty());
+        CHECK(results.back().name == "last");
+        CHECK(results.size() < 100 * 50);
+    }
+
+    SECTION("Command list")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+
+        sf::RectangleShape shape1({50, 50});
+        shape1.setFillColor(sf::Color::Green);
+        sf::RectangleShape shape2({50, 50});
+        shape2.setFillColor(sf::Color::Blue);
+        shape2.setPosition({50, 0});
+
+        sf::RenderCommandList commandList;
+        renderTexture.beginRecording(commandList);
+        renderTexture.draw(shape1);
+        renderTexture.draw(shape2);
+        renderTexture.endRecording();
+        CHECK(commandList.getCommandCount() == 1);
+
+        // Replay the commands twice, the second time shifted downwards
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.draw(commandList);
+        renderTexture.draw(commandList, sf::Transform().translate({0, 50}));
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 25}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 25}) == sf::Color::Blue);
+        CHECK(image.getPixel({25, 75}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 75}) == sf::Color::Blue);
+    }
+
+    SECTION("Indexed drawing")
+    {
+        if (!sf::IndexBuffer::isAvailable())
+            return;
+
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        // A quad covering the left half of the target, made of 4 shared vertices
+        const std::array vertices = {sf::Vertex{{0, 0}, sf::Color::Green},
+                                     sf::Vertex{{50, 0}, sf::Color::Green},
+                                     sf::Vertex{{0, 100}, sf::Color::Green},
+                                     sf::Vertex{{50, 100}, sf::Color::Green}};
+        const std::array<std::uint16_t, 6> indices = {0, 1, 2, 2, 1, 3};
+
+        sf::VertexBuffer vertexBuffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static);
+        REQUIRE(vertexBuffer.create(vertices.size()));
+        REQUIRE(vertexBuffer.update(vertices.data()));
+
+        sf::IndexBuffer indexBuffer(sf::IndexBuffer::Type::UInt16, sf::IndexBuffer::Usage::Static);
+        REQUIRE(indexBuffer.create(indices.size()));
+        REQUIRE(indexBuffer.update(indices.data()));
+
+        SECTION("Whole buffer")
+        {
+            renderTexture.draw(vertexBuffer, indexBuffer);
+            renderTexture.display();
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({10, 10}) == sf::Color::Green);
+            CHECK(image.getPixel({40, 90}) == sf::Color::Green);
+            CHECK(image.getPixel({75, 50}) == sf::Color::Red);
+        }
+
+        SECTION("Index range")
+        {
+            // Only the second triangle, which covers the bottom right corner of the quad
+            renderTexture.draw(vertexBuffer, indexBuffer, 3, 3);
+            renderTexture.display();
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({10, 10}) == sf::Color::Red);
+            CHECK(image.getPixel({40, 90}) == sf::Color::Green);
+        }
+    }
+
+    SECTION("Streaming vertex buffer")
+    {
+        if (!sf::VertexBuffer::isAvailable())
+            return;
+
+        sf::RenderTexture renderTexture({100, 100});
+        sf::VertexBuffer  vertexBuffer(sf::PrimitiveType::TriangleStrip, sf::VertexBuffer::Usage::Streaming);
+        REQUIRE(vertexBuffer.create(4));
+
+        // Draw a quad sliding to the right every frame, going around the ring a few times
+        for (int frame = 0; frame < 10; ++frame)
+        {
+            const float left = static_cast<float>(frame * 10);
+
+            sf::Vertex* vertices = vertexBuffer.map(4);
+            REQUIRE(vertices != nullptr);
+            vertices[0] = sf::Vertex{{left, 0}, sf::Color::Green};
+            vertices[1] = sf::Vertex{{left + 10, 0}, sf::Color::Green};
+            vertices[2] = sf::Vertex{{left, 100}, sf::Color::Green};
+            vertices[3] = sf::Vertex{{left + 10, 100}, sf::Color::Green};
+            REQUIRE(vertexBuffer.unmap());
+
+            renderTexture.clear(sf::Color::Red);
+            renderTexture.draw(vertexBuffer);
+        }
+
+        renderTexture.display();
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({95, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({85, 50}) == sf::Color::Red);
+    }
+
+    SECTION("Instanced drawing")
+    {
+        if (!sf::VertexBuffer::isAvailable())
+            return;
+
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        // A 25x25 white quad, drawn once in the top left corner and once, tinted green, in the bottom right one
+        const std::array vertices = {sf::Vertex{{0, 0}}, sf::Vertex{{25, 0}}, sf::Vertex{{0, 25}}, sf::Vertex{{25, 25}}};
+
+        sf::VertexBuffer vertexBuffer(sf::PrimitiveType::TriangleStrip, sf::VertexBuffer::Usage::Static);
+        REQUIRE(vertexBuffer.create(vertices.size()));
+        REQUIRE(vertexBuffer.update(vertices.data()));
+
+        std::array<sf::InstanceBuffer::Instance, 2> instances;
+        instances[1].setTransform(sf::Transform(1, 0, 75, 0, 1, 75, 0, 0, 1));
+        instances[1].color = sf::Color::Green;
+
+        sf::InstanceBuffer instanceBuffer(sf::InstanceBuffer::Usage::Static);
+        REQUIRE(instanceBuffer.create(instances.size()));
+        REQUIRE(instanceBuffer.update(instances.data()));
+
+        SECTION("Default shader")
+        {
+            renderTexture.drawInstanced(vertexBuffer, instanceBuffer);
+        }
+
+        SECTION("Custom shader")
+        {
+            // User shaders always go through the CPU fallback
+            if (!sf::Shader::isAvailable())
+                return;
+
+            sf::Shader shader;
+            REQUIRE(shader.loadFromMemory("void main() { gl_FragColor = gl_Color; }", sf::Shader::Type::Fragment));
+            renderTexture.drawInstanced(vertexBuffer, instanceBuffer, &shader);
+        }
+
+        renderTexture.display();
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({10, 10}) == sf::Color::White);
+        CHECK(image.getPixel({90, 90}) == sf::Color::Green);
+        CHECK(image.getPixel({50, 50}) == sf::Color::Red);
+    }
+
+    SECTION("Vertex cache")
+    {
+        // Two triangles forming a unit square, followed by a degenerate one, so that
+        // the number of vertices isn't a multiple of the SIMD width of the transform
+        const std::array<sf::Vector2f, 6> corners = {sf::Vector2f(0, 0),
+                                                     sf::Vector2f(1, 0),
+                                                     sf::Vector2f(1, 1),
+                                                     sf::Vector2f(0, 0),
+                                                     sf::Vector2f(1, 1),
+                                                     sf::Vector2f(0, 1)};
+
+        std::array<sf::Vertex, 9> vertices{};
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+        {
+            vertices[i].position = i < corners.size() ? corners[i] : sf::Vector2f(0, 0);
+            vertices[i].color    = sf::Color::Green;
+        }
+
+        sf::Transform transform;
+        transform.translate({50, 10}).rotate(sf::degrees(45)).scale({40, 40});
+
+        // Render the vertices pre-transformed on the CPU, and transformed by the model matrix
+        const auto render = [&](std::size_t vertexCacheSize)
+        {
+            sf::RenderTexture renderTexture({100, 100});
+            renderTexture.setVertexCacheSize(vertexCacheSize);
+            renderTexture.clear(sf::Color::Red);
+            renderTexture.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, transform);
+            renderTexture.display();
+            return renderTexture.getTexture().copyToImage();
+        };
+
+        const sf::Image preTransformed = render(vertices.size());
+        const sf::Image matrix         = render(0);
+
+        // The square is rotated into a diamond with its corners at (50, 10), (78, 38), (50, 67) and (22, 38)
+        CHECK(preTransformed.getPixel({50, 38}) == sf::Color::Green);
+        CHECK(preTransformed.getPixel({50, 5}) == sf::Color::Red);
+        CHECK(preTransformed.getPixel({15, 38}) == sf::Color::Red);
+        CHECK(preTransformed.getPixel({50, 75}) == sf::Color::Red);
+
+        for (unsigned int y = 5; y < 100; y += 10)
+            for (unsigned int x = 5; x < 100; x += 10)
+                CHECK(preTransformed.getPixel({x, y}) == matrix.getPixel({x, y}));
+    }
+
+    SECTION("Core backend")
+    {
+        sf::Image textureImage({2, 2}, sf::Color::Blue);
+        textureImage.setPixel({1, 1}, sf::Color::Yellow);
+        const sf::Texture texture(textureImage);
+
+        // Render the same scene with both backends, the results must match
+        const auto render = [&texture](sf::RenderTarget::Backend backend)
+        {
+            sf::RenderTexture renderTexture({100, 100});
+            renderTexture.setBackend(backend);
+            renderTexture.clear(sf::Color::Red);
+
+            // Small enough to be pre-transformed in the vertex cache
+            sf::RectangleShape rectangle({50, 50});
+            rectangle.setFillColor(sf::Color::Green);
+            renderTexture.draw(rectangle);
+
+            // Large enough to be transformed by the model matrix
+            sf::CircleShape circle(25, 64);
+            circle.setPosition({50, 0});
+            circle.setFillColor(sf::Color::Cyan);
+            renderTexture.draw(circle);
+
+            // Pixel texture coordinates, scaled by the texture matrix
+            sf::Sprite sprite(texture);
+            sprite.setPosition({0, 50});
+            sprite.setScale({25, 25});
+            renderTexture.draw(sprite);
+
+            renderTexture.display();
+            return std::pair(renderTexture.getTexture().copyToImage(), renderTexture.getActiveBackend());
+        };
+
+        const auto [fixedFunction, fixedFunctionBackend] = render(sf::RenderTarget::Backend::FixedFunction);
+        const auto [core, coreBackend]                   = render(sf::RenderTarget::Backend::Core);
+        CHECK(fixedFunctionBackend == sf::RenderTarget::Backend::FixedFunction);
+
+        // The core backend falls back to the fixed-function one if it is not available,
+        // comparing the images would then prove nothing
+        if (coreBackend != sf::RenderTarget::Backend::Core)
+            return;
+
+        CHECK(core.getPixel({25, 25}) == sf::Color::Green);
+        CHECK(core.getPixel({75, 25}) == sf::Color::Cyan);
+        CHECK(core.getPixel({10, 60}) == sf::Color::Blue);
+        CHECK(core.getPixel({40, 90}) == sf::Color::Yellow);
+        CHECK(core.getPixel({75, 75}) == sf::Color::Red);
+
+        for (const sf::Vector2u pixel : {sf::Vector2u(25, 25),
+                                         sf::Vector2u(75, 25),
+                                         sf::Vector2u(10, 60),
+                                         sf::Vector2u(40, 90),
+                                         sf::Vector2u(75, 75)})
+            CHECK(core.getPixel(pixel) == fixedFunction.getPixel(pixel));
+    }
+}
+
+TEST_CASE("[Graphics] Vertex cache benchmark", "[.benchmark]")
+{
+    // Many small quads, drawn as a single array
+    std::vector<sf::Vertex> vertices(4096);
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+        vertices[i].position = {static_cast<float>(i % 64), static_cast<float>(i / 64)};
+        vertices[i].color    = sf::Color::Green;
+    }
+
+    sf::Transform transform;
+    transform.translate({50, 10}).rotate(sf::degrees(45)).scale({2, 2});
+
+    std::vector<sf::Vertex> output(vertices.size());
+    BENCHMARK("Transform 4096 vertices with transformPoint")
+    {
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+        {
+            output[i]          = vertices[i];
+            output[i].position = transform.transformPoint(vertices[i].position);
+        }
+        return output.back().position;
+    };
+
+    // The vertex cache transforms the vertices with the SIMD kernel, if the CPU has one
+    sf::RenderTexture preTransformed({100, 100});
+    preTransformed.setVertexCacheSize(vertices.size());
+
+    BENCHMARK("Draw 4096 pre-transformed vertices")
+    {
+        preTransformed.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, transform);
+        preTransformed.display();
+    };
+
+    sf::RenderTexture matrix({100, 100});
+    matrix.setVertexCacheSize(0);
+
+    BENCHMARK("Draw 4096 vertices with the model matrix")
+    {
+        matrix.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, transform);
+        matrix.display();
+    };
 }
@@ -0,0 +1,100 @@
+#include <SFML/Graphics/RenderCommandList.hpp>
+
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <type_traits>
+
+namespace
+{
+class RecordingTarget : public sf::RenderTarget
+{
+public:
+    RecordingTarget() = default;
+
+private:
+    sf::Vector2u getSize() const override
+    {
+        return {640, 480};
+    }
+};
+} // namespace
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::RenderCommandList", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::RenderCommandList>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::RenderCommandList>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::RenderCommandList>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::RenderCommandList>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::RenderCommandList commandList;
+        CHECK(commandList.isEmpty());
+        CHECK(commandList.getCommandCount() == 0);
+        CHECK(commandList.getVertexCount() == 0);
+    }
+
+    SECTION("Recording")
+    {
+        RecordingTarget       renderTarget;
+        sf::RenderCommandList commandList;
+
+        const std::array quad = {sf::Vertex{{0, 0}}, sf::Vertex{{10, 0}}, sf::Vertex{{0, 10}}, sf::Vertex{{10, 10}}};
+        const std::array line = {sf::Vertex{{0, 0}}, sf::Vertex{{10, 10}}};
+
+        renderTarget.beginRecording(commandList);
+        CHECK(renderTarget.isRecording());
+
+        SECTION("Compatible draws are merged")
+        {
+            const sf::Transform offset = sf::Transform().translate({20, 0});
+            renderTarget.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip);
+            renderTarget.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip, offset);
+            renderTarget.endRecording();
+
+            CHECK(!renderTarget.isRecording());
+            CHECK(commandList.getCommandCount() == 1);
+            CHECK(commandList.getVertexCount() == 12);
+        }
+
+        SECTION("Incompatible draws are not merged")
+        {
+            renderTarget.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip);
+            renderTarget.draw(line.data(), line.size(), sf::PrimitiveType::Lines);
+            renderTarget.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip, sf::BlendAdd);
+            renderTarget.endRecording();
+
+            CHECK(commandList.getCommandCount() == 3);
+            CHECK(commandList.getVertexCount() == 14);
+        }
+
+        SECTION("Recording again")
+        {
+            renderTarget.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip);
+            renderTarget.endRecording();
+            CHECK(!commandList.isEmpty());
+
+            renderTarget.beginRecording(commandList);
+            renderTarget.endRecording();
+            CHECK(commandList.isEmpty());
+        }
+
+        SECTION("clear()")
+        {
+            renderTarget.draw(line.data(), line.size(), sf::PrimitiveType::Lines);
+            renderTarget.endRecording();
+
+            commandList.clear();
+            CHECK(commandList.isEmpty());
+            CHECK(commandList.getCommandCount() == 0);
+            CHECK(commandList.getVertexCount() == 0);
+        }
+    }
+}
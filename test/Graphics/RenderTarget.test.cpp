@@ -61,6 +61,89 @@ TEST_CASE("[Graphics] sf::RenderTarget")
         CHECK(renderTarget.setActive(true));
     }
 
+    SECTION("Batching")
+    {
+        RenderTarget renderTarget;
+        CHECK(!renderTarget.isBatchingEnabled());
+
+        renderTarget.setBatchingEnabled(true);
+        CHECK(renderTarget.isBatchingEnabled());
+        renderTarget.setBatchingEnabled(false);
+        CHECK(!renderTarget.isBatchingEnabled());
+    }
+
+    SECTION("Deferred drawing")
+    {
+        RenderTarget renderTarget;
+        CHECK(!renderTarget.isDeferredDrawingEnabled());
+        CHECK(renderTarget.getDrawLayer() == 0);
+
+        renderTarget.setDeferredDrawingEnabled(true);
+        CHECK(renderTarget.isDeferredDrawingEnabled());
+        renderTarget.setDrawLayer(-3);
+        CHECK(renderTarget.getDrawLayer() == -3);
+        renderTarget.setDeferredDrawingEnabled(false);
+        CHECK(!renderTarget.isDeferredDrawingEnabled());
+    }
+
+    SECTION("Statistics")
+    {
+        RenderTarget renderTarget;
+        CHECK(renderTarget.getStatistics().drawCalls == 0);
+        CHECK(renderTarget.getStatistics().vertices == 0);
+        CHECK(renderTarget.getStatistics().blendModeChanges == 0);
+        CHECK(renderTarget.getStatistics().stencilModeChanges == 0);
+        CHECK(renderTarget.getStatistics().textureChanges == 0);
+        CHECK(renderTarget.getStatistics().shaderChanges == 0);
+        CHECK(renderTarget.getStatistics().viewChanges == 0);
+        CHECK(renderTarget.getStatistics().transformChanges == 0);
+        CHECK(renderTarget.getStatistics().vertexCacheHits == 0);
+        CHECK(renderTarget.getStatistics().submittedDraws == 0);
+        CHECK(renderTarget.getStatistics().mergedDraws == 0);
+        CHECK(renderTarget.getStatistics().flushedBatches == 0);
+    }
+
+    SECTION("formatChromeTrace()")
+    {
+        CHECK(sf::RenderTarget::formatChromeTrace({}) == "{\"traceEvents\":[\n]}\n");
+
+        std::vector<sf::RenderTarget::ProfileResult> results(2);
+        results[0].name     = "frame";
+        results[0].duration = sf::microseconds(300);
+        results[0].gpuTime  = true;
+        results[1].name     = "say \"hi\"\n";
+        results[1].depth    = 1;
+        results[1].start    = sf::microseconds(100);
+        results[1].duration = sf::microseconds(50);
+
+        CHECK(sf::RenderTarget::formatChromeTrace(results) ==
+              "{\"traceEvents\":[\n"
+              "{\"name\":\"frame\",\"cat\":\"gpu\",\"ph\":\"X\",\"ts\":0,\"dur\":300,\"pid\":0,\"tid\":0,\"args\":{\"depth\":0}},\n"
+              "{\"name\":\"say \\\"hi\\\"\\u000a\",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":100,\"dur\":50,\"pid\":0,\"tid\":1,\"args\":{\"depth\":1}}"
+              "\n]}\n");
+    }
+
+    SECTION("Set/get vertex cache size")
+    {
+        RenderTarget renderTarget;
+        CHECK(renderTarget.getVertexCacheSize() == 4);
+        renderTarget.setVertexCacheSize(64);
+        CHECK(renderTarget.getVertexCacheSize() == 64);
+        renderTarget.setVertexCacheSize(0);
+        CHECK(renderTarget.getVertexCacheSize() == 0);
+    }
+
+    SECTION("Set/get backend")
+    {
+        RenderTarget renderTarget;
+        CHECK(renderTarget.getActiveBackend() == sf::RenderTarget::Backend::FixedFunction);
+        CHECK(renderTarget.getBackend() == sf::RenderTarget::Backend::Automatic);
+        renderTarget.setBackend(sf::RenderTarget::Backend::Core);
+        CHECK(renderTarget.getBackend() == sf::RenderTarget::Backend::Core);
+        renderTarget.setBackend(sf::RenderTarget::Backend::FixedFunction);
+        CHECK(renderTarget.getBackend() == sf::RenderTarget::Backend::FixedFunction);
+    }
+
     const auto makeView = [](const auto& viewport)
     {
         sf::View view;
@@ -2,6 +2,7 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include <SFML/Window/VideoMode.hpp>
@@ -89,4 +90,23 @@ TEST_CASE("[Graphics] sf::RenderWindow", runDisplayTests())
         texture.update(window);
         CHECK(texture.copyToImage().getPixel(sf::Vector2u(196, 196)) == sf::Color::Blue);
     }
+
+    SECTION("display() flushes the batch")
+    {
+        sf::RenderWindow window(sf::VideoMode(sf::Vector2u(256, 256), 24),
+                                "Window Title",
+                                sf::Style::Default,
+                                sf::State::Windowed,
+                                sf::ContextSettings{});
+        window.setBatchingEnabled(true);
+        window.resetStatistics();
+
+        window.clear(sf::Color::Red);
+        window.draw(sf::RectangleShape({256, 256}));
+        CHECK(window.getStatistics().flushedBatches == 0);
+
+        // The batch must be flushed even if display() is called through the base class
+        static_cast<sf::Window&>(window).display();
+        CHECK(window.getStatistics().flushedBatches == 1);
+    }
 }
@@ -1,11 +1,19 @@
 #include <SFML/Graphics/Shader.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
+
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <filesystem>
+#include <fstream>
 #include <type_traits>
 
 namespace
@@ -103,6 +111,43 @@ void main()
 }
 )";
 
+constexpr auto blockFragmentSource = R"(
+#version 140
+
+layout(std140) uniform Frame
+{
+    vec4 tint;
+};
+
+out vec4 color;
+
+void main()
+{
+    color = tint;
+}
+)";
+
+constexpr auto colorFragmentSource = R"(
+uniform vec4 color;
+
+void main()
+{
+    gl_FragColor = color;
+}
+)";
+
+// Draw a white square with a shader and read the color of the resulting pixels back
+sf::Color renderPixel(const sf::Shader& shader)
+{
+    sf::RenderTexture renderTexture({4, 4});
+    sf::RenderStates  states(&shader);
+    states.blendMode = sf::BlendNone;
+    renderTexture.clear(sf::Color::Transparent);
+    renderTexture.draw(sf::RectangleShape({4, 4}), states);
+    renderTexture.display();
+    return renderTexture.getTexture().copyToImage().getPixel({1, 1});
+}
+
 #ifdef SFML_RUN_DISPLAY_TESTS
 #ifdef SFML_OPENGL_ES
 constexpr bool skipShaderDummyTest = false;
@@ -167,6 +212,12 @@ TEST_CASE("[Graphics] sf::Shader (Dummy Implementation)", skipShaderDummyTests()
         CHECK_FALSE(shader.loadFromMemory(vertexSource, fragmentSource));
         CHECK_FALSE(shader.loadFromMemory(vertexSource, geometrySource, fragmentSource));
     }
+
+    SECTION("getUniformHandle()")
+    {
+        sf::Shader shader;
+        CHECK(!shader.getUniformHandle("blink_alpha").isValid());
+    }
 }
 
 TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
@@ -482,4 +533,184 @@ TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
             CHECK(static_cast<bool>(shader.getNativeHandle()) == sf::Shader::isGeometryAvailable());
         }
     }
+
+    SECTION("getUniformHandle()")
+    {
+        CHECK(!sf::Shader::UniformHandle().isValid());
+
+        sf::Shader shader;
+        CHECK(!shader.getUniformHandle("blink_alpha").isValid());
+
+        if (sf::Shader::isAvailable())
+        {
+            REQUIRE(shader.loadFromMemory(fragmentSource, sf::Shader::Type::Fragment));
+            const sf::Shader::UniformHandle handle = shader.getUniformHandle("blink_alpha");
+            CHECK(handle.isValid());
+            CHECK(!shader.getUniformHandle("does_not_exist").isValid());
+            shader.setUniform(handle, 1.f);
+            CHECK(renderPixel(shader).a == 255);
+            shader.setUniform("blink_alpha", 0.f);
+            CHECK(renderPixel(shader).a == 0);
+
+            // Handles of another shader are ignored, even if the uniform has the same location
+            sf::Shader otherShader;
+            REQUIRE(otherShader.loadFromMemory(fragmentSource, sf::Shader::Type::Fragment));
+            otherShader.setUniform(otherShader.getUniformHandle("blink_alpha"), 1.f);
+            otherShader.setUniform(handle, 0.f);
+            CHECK(renderPixel(otherShader).a == 255);
+
+            // Handles of the previous program are ignored once the shader is loaded again
+            REQUIRE(shader.loadFromMemory(fragmentSource, sf::Shader::Type::Fragment));
+            shader.setUniform(shader.getUniformHandle("blink_alpha"), 1.f);
+            shader.setUniform(handle, 0.f);
+            CHECK(renderPixel(shader).a == 255);
+        }
+    }
+
+    SECTION("Binary cache")
+    {
+        const auto directory = std::filesystem::temp_directory_path() / "sfml-shader-cache";
+        std::filesystem::remove_all(directory);
+
+        CHECK(sf::Shader::getBinaryCacheDirectory().empty());
+        sf::Shader::setBinaryCacheDirectory(directory);
+        CHECK(sf::Shader::getBinaryCacheDirectory() == directory);
+
+        if (sf::Shader::isAvailable())
+        {
+            const sf::Shader::BinaryCacheStatistics before = sf::Shader::getBinaryCacheStatistics();
+
+            sf::Shader compiledShader;
+            REQUIRE(compiledShader.loadFromMemory(colorFragmentSource, sf::Shader::Type::Fragment));
+            compiledShader.setUniform("color", sf::Glsl::Vec4(sf::Color::Red));
+            CHECK(renderPixel(compiledShader) == sf::Color::Red);
+            const sf::Shader::BinaryCacheStatistics compiled = sf::Shader::getBinaryCacheStatistics();
+
+            // Programs loaded from the cache behave like compiled ones
+            sf::Shader cachedShader;
+            REQUIRE(cachedShader.loadFromMemory(colorFragmentSource, sf::Shader::Type::Fragment));
+            cachedShader.setUniform("color", sf::Glsl::Vec4(sf::Color::Blue));
+            CHECK(renderPixel(cachedShader) == sf::Color::Blue);
+            const sf::Shader::BinaryCacheStatistics cached = sf::Shader::getBinaryCacheStatistics();
+
+            // Every load is either counted once or not at all if the driver doesn't support program binaries
+            const bool supported = compiled.misses != before.misses;
+            CHECK(compiled.hits == before.hits);
+            CHECK(compiled.misses == before.misses + (supported ? 1 : 0));
+            CHECK(cached.hits + cached.misses == compiled.hits + compiled.misses + (supported ? 1 : 0));
+            CHECK(cached.writes >= compiled.writes);
+            if (compiled.writes == before.writes + 1)
+                CHECK(cached.hits == compiled.hits + 1);
+
+            // No temporary files are left behind
+            std::size_t cacheFiles = 0;
+            if (std::filesystem::exists(directory))
+            {
+                for (const auto& entry : std::filesystem::directory_iterator(directory))
+                {
+                    CHECK(entry.path().extension() == ".bin");
+                    ++cacheFiles;
+
+                    // Change the stored source hash, the cache must not be trusted anymore
+                    constexpr std::streamoff hashOffset = 8;
+                    constexpr auto           mode       = std::ios_base::in | std::ios_base::out | std::ios_base::binary;
+                    auto                     file       = std::fstream(entry.path(), mode);
+                    file.seekg(hashOffset);
+                    const int byte = file.get();
+                    file.seekp(hashOffset);
+                    file.put(static_cast<char>(byte ^ 0xFF));
+                }
+            }
+            CHECK(cacheFiles == cached.writes - before.writes);
+
+            // Binaries of other sources are rejected and the program is compiled again
+            sf::Shader mismatchedShader;
+            REQUIRE(mismatchedShader.loadFromMemory(colorFragmentSource, sf::Shader::Type::Fragment));
+            mismatchedShader.setUniform("color", sf::Glsl::Vec4(sf::Color::Green));
+            CHECK(renderPixel(mismatchedShader) == sf::Color::Green);
+            const sf::Shader::BinaryCacheStatistics mismatched = sf::Shader::getBinaryCacheStatistics();
+            CHECK(mismatched.hits == cached.hits);
+            CHECK(mismatched.misses == cached.misses + (supported ? 1 : 0));
+        }
+
+        sf::Shader::setBinaryCacheDirectory({});
+        CHECK(sf::Shader::getBinaryCacheDirectory().empty());
+        std::filesystem::remove_all(directory);
+    }
+
+    SECTION("setUniformBlock()")
+    {
+        sf::Shader        shader;
+        sf::UniformBuffer buffer;
+
+        if (sf::UniformBuffer::isAvailable())
+        {
+            REQUIRE(buffer.create(16));
+            REQUIRE(shader.loadFromMemory(blockFragmentSource, sf::Shader::Type::Fragment));
+            shader.setUniformBlock("Frame", buffer);
+            shader.setUniformBlock("does_not_exist", buffer);
+
+            sf::Shader otherShader;
+            REQUIRE(otherShader.loadFromMemory(blockFragmentSource, sf::Shader::Type::Fragment));
+            otherShader.setUniformBlock("Frame", buffer);
+
+            // Both programs read the same buffer, updates are seen by each of them
+            const sf::Glsl::Vec4 green(sf::Color::Green);
+            REQUIRE(buffer.update(&green));
+            CHECK(renderPixel(shader) == sf::Color::Green);
+            CHECK(renderPixel(otherShader) == sf::Color::Green);
+
+            const sf::Glsl::Vec4 blue(sf::Color::Blue);
+            REQUIRE(buffer.update(&blue));
+            CHECK(renderPixel(shader) == sf::Color::Blue);
+            CHECK(renderPixel(otherShader) == sf::Color::Blue);
+        }
+        else
+        {
+            CHECK(!buffer.create(16));
+        }
+    }
+
+    SECTION("setUniformUploadDeferred()")
+    {
+        sf::Shader shader;
+        CHECK(!shader.isUniformUploadDeferred());
+
+        if (sf::Shader::isAvailable())
+        {
+            REQUIRE(shader.loadFromMemory(fragmentSource, sf::Shader::Type::Fragment));
+            shader.setUniformUploadDeferred(true);
+            CHECK(shader.isUniformUploadDeferred());
+
+            const sf::Shader::UniformHandle handle = shader.getUniformHandle("blink_alpha");
+            shader.setUniform(handle, 0.25f);
+            shader.setUniform(handle, 0.5f);
+            shader.setUniform("blink_alpha", 0.5f);
+            sf::Shader::bind(&shader);
+            sf::Shader::bind(nullptr);
+
+            shader.setUniform(handle, 0.75f);
+            shader.setUniformUploadDeferred(false);
+            CHECK(!shader.isUniformUploadDeferred());
+
+            const sf::Shader movedShader(std::move(shader));
+            CHECK(!movedShader.isUniformUploadDeferred());
+
+            // Deferred values are uploaded when the shader is bound to draw
+            sf::Shader colorShader;
+            REQUIRE(colorShader.loadFromMemory(colorFragmentSource, sf::Shader::Type::Fragment));
+            colorShader.setUniformUploadDeferred(true);
+            colorShader.setUniform("color", sf::Glsl::Vec4(sf::Color::Red));
+            CHECK(renderPixel(colorShader) == sf::Color::Red);
+
+            const sf::Shader::UniformHandle colorHandle = colorShader.getUniformHandle("color");
+            colorShader.setUniform(colorHandle, sf::Glsl::Vec4(sf::Color::Blue));
+            colorShader.setUniform(colorHandle, sf::Glsl::Vec4(sf::Color::Green));
+            CHECK(renderPixel(colorShader) == sf::Color::Green);
+
+            // Values set again without changing aren't uploaded again, but stay in effect
+            colorShader.setUniform(colorHandle, sf::Glsl::Vec4(sf::Color::Green));
+            CHECK(renderPixel(colorShader) == sf::Color::Green);
+        }
+    }
 }
@@ -2,11 +2,18 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/View.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <string>
 #include <type_traits>
 
 TEST_CASE("[Graphics] sf::Text", runDisplayTests())
@@ -84,6 +91,123 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         CHECK(text.getString() == "abcdefghijklmnopqrstuvwxyz");
     }
 
+    SECTION("insertString() and eraseString()")
+    {
+        sf::Text text(font, "first line\nsecond line\nthird line", 24);
+        text.setStyle(sf::Text::Underlined);
+        CHECK(text.getLocalBounds() == sf::Text(font, "first line\nsecond line\nthird line", 24).getLocalBounds());
+
+        const auto checkBounds = [&]
+        {
+            sf::Text expected(font, text.getString(), 24);
+            expected.setStyle(sf::Text::Underlined);
+            CHECK(text.getLocalBounds() == Approx(expected.getLocalBounds()));
+        };
+
+        text.insertString(5, " long");
+        CHECK(text.getString() == "first long line\nsecond line\nthird line");
+        checkBounds();
+
+        text.insertString(0, "zeroth line\n");
+        CHECK(text.getString() == "zeroth line\nfirst long line\nsecond line\nthird line");
+        checkBounds();
+
+        text.eraseString(12, 16);
+        CHECK(text.getString() == "zeroth line\nsecond line\nthird line");
+        checkBounds();
+
+        text.insertString(1'000, "\nfourth line, the longest one");
+        CHECK(text.getString() == "zeroth line\nsecond line\nthird line\nfourth line, the longest one");
+        checkBounds();
+
+        text.eraseString(24, 1'000);
+        CHECK(text.getString() == "zeroth line\nsecond line\n");
+        checkBounds();
+
+        text.setString("zeroth line\nsecond\nline\n");
+        checkBounds();
+
+        text.eraseString(0, 1'000);
+        CHECK(text.getString().isEmpty());
+        CHECK(text.getLocalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Edited text is drawn like a new one")
+    {
+        sf::RenderTexture renderTexture({200, 200});
+
+        const auto render = [&renderTexture](const sf::Text& drawnText)
+        {
+            renderTexture.clear();
+            renderTexture.draw(drawnText);
+            renderTexture.display();
+            return renderTexture.getTexture().copyToImage();
+        };
+
+        const auto checkRendering = [&](const sf::Text& text)
+        {
+            sf::Text expected(font, text.getString(), 20);
+            expected.setOutlineThickness(1);
+            const sf::Image expectedImage = render(expected);
+            const sf::Image image         = render(text);
+            CHECK(std::equal(image.getPixelsPtr(),
+                             image.getPixelsPtr() + image.getSize().x * image.getSize().y * 4,
+                             expectedImage.getPixelsPtr()));
+        };
+
+        sf::Text text(font, "first\nsecond\nthird\nfourth", 20);
+        text.setOutlineThickness(1);
+        (void)render(text);
+
+        // The following lines are moved without being laid out again
+        text.insertString(0, "zeroth\n");
+        checkRendering(text);
+
+        text.insertString(12, " and a half\nsecond");
+        checkRendering(text);
+
+        text.eraseString(0, 7);
+        checkRendering(text);
+    }
+
+    SECTION("Text laid out while its font page is reset")
+    {
+        constexpr std::size_t pageBytes = 128 * 128 * 4;
+
+        sf::RenderTexture renderTexture({300, 60});
+
+        const auto render = [&renderTexture](const sf::Font& textFont)
+        {
+            renderTexture.clear();
+            renderTexture.draw(sf::Text(textFont, "ABCDEF", 40));
+            renderTexture.display();
+            return renderTexture.getTexture().copyToImage();
+        };
+
+        const sf::Image expectedImage = render(font);
+
+        // Fill the page more and more before laying the text out, so that the page
+        // gets reset at some point in the middle of the layout
+        bool pageReset = false;
+        for (char32_t codePoint = U'a'; codePoint <= U'z'; ++codePoint)
+        {
+            sf::Font budgetedFont("Graphics/tuffy.ttf");
+            budgetedFont.setMemoryBudget(pageBytes);
+            for (char32_t loaded = U'a'; loaded <= codePoint; ++loaded)
+                (void)budgetedFont.getGlyph(loaded, 40, false);
+
+            const std::uint64_t evictions = budgetedFont.getCacheStatistics().evictions;
+            const sf::Image     image     = render(budgetedFont);
+            pageReset                     = pageReset || (budgetedFont.getCacheStatistics().evictions > evictions);
+
+            CHECK(std::equal(image.getPixelsPtr(),
+                             image.getPixelsPtr() + image.getSize().x * image.getSize().y * 4,
+                             expectedImage.getPixelsPtr()));
+        }
+
+        CHECK(pageReset);
+    }
+
     SECTION("Set/get font")
     {
         sf::Text       text(font);
@@ -120,6 +244,109 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         CHECK(text.getStyle() == (sf::Text::Bold | sf::Text::Italic));
     }
 
+    SECTION("Set/get max width")
+    {
+        sf::Text text(font);
+        text.setMaxWidth(200);
+        CHECK(text.getMaxWidth() == 200);
+    }
+
+    SECTION("Set/get alignment")
+    {
+        sf::Text text(font);
+        text.setAlignment(sf::Text::Alignment::Center);
+        CHECK(text.getAlignment() == sf::Text::Alignment::Center);
+    }
+
+    SECTION("Line wrapping")
+    {
+        sf::Text text(font, "one two");
+        CHECK(text.getLineCount() == 1);
+
+        // "t" still fits, "w" doesn't: the line is wrapped after the space
+        text.setMaxWidth(text.findCharacterPos(5).x);
+        CHECK(text.getLineCount() == 2);
+        CHECK(text.findCharacterPos(4) == sf::Vector2f(0, font.getLineSpacing(30)));
+
+        // Words wider than the maximum width are wrapped between characters
+        text.setString("abcdefghijklmnopqrstuvwxyz");
+        CHECK(text.getLineCount() > 1);
+
+        // Lines wrapped within a modified paragraph are laid out again
+        text.setString("one two\nthree four");
+        text.insertString(0, "zero ");
+        text.eraseString(text.getString().getSize() - 5, 5);
+        sf::Text expected(font, "zero one two\nthree");
+        expected.setMaxWidth(text.getMaxWidth());
+        CHECK(text.getLineCount() == expected.getLineCount());
+        CHECK(text.getLocalBounds() == Approx(expected.getLocalBounds()));
+
+        text.setMaxWidth(0);
+        CHECK(text.getLineCount() == 2);
+    }
+
+    SECTION("Alignment")
+    {
+        sf::Text text(font, "a\nabc");
+        const float width = text.findCharacterPos(5).x;
+        CHECK(text.findCharacterPos(2).x == 0);
+
+        SECTION("Within the widest line")
+        {
+            text.setAlignment(sf::Text::Alignment::Right);
+            CHECK(text.findCharacterPos(2).x == 0);
+            CHECK(text.findCharacterPos(0).x == Approx(width - text.findCharacterPos(1).x));
+
+            text.setAlignment(sf::Text::Alignment::Center);
+            CHECK(text.findCharacterPos(0).x == Approx((width - text.findCharacterPos(1).x) / 2));
+        }
+
+        SECTION("Within the maximum width")
+        {
+            text.setMaxWidth(500);
+            text.setAlignment(sf::Text::Alignment::Right);
+            CHECK(text.findCharacterPos(2).x == Approx(500 - width));
+            CHECK(text.getLocalBounds().position.x > 400);
+        }
+    }
+
+    SECTION("Lines outside the view are not drawn")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+
+        sf::String string;
+        for (int i = 0; i < 100; ++i)
+            string += "line\n";
+        sf::Text text(font, string, 20);
+
+        renderTexture.setView(sf::View(text.getLocalBounds()));
+        renderTexture.draw(text);
+        renderTexture.display();
+        const std::size_t allVertices = renderTexture.getStatistics().vertices;
+
+        renderTexture.resetStatistics();
+        renderTexture.setView(renderTexture.getDefaultView());
+        renderTexture.draw(text);
+        renderTexture.display();
+        const std::size_t visibleVertices = renderTexture.getStatistics().vertices;
+
+        renderTexture.resetStatistics();
+        text.setPosition({0, -10'000});
+        renderTexture.draw(text);
+        renderTexture.display();
+        const std::size_t hiddenVertices = renderTexture.getStatistics().vertices;
+
+#ifdef SFML_ENABLE_RENDER_STATISTICS
+        CHECK(visibleVertices > 0);
+        CHECK(visibleVertices < allVertices / 10);
+        CHECK(hiddenVertices == 0);
+#else
+        CHECK(allVertices == 0);
+        CHECK(visibleVertices == 0);
+        CHECK(hiddenVertices == 0);
+#endif
+    }
+
     SECTION("Set/get fill color")
     {
         sf::Text text(font, "Fill color");
@@ -184,3 +411,29 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         }
     }
 }
+
+TEST_CASE("[Graphics] sf::Text benchmark", "[.benchmark]")
+{
+    const sf::Font font("Graphics/tuffy.ttf");
+
+    // Mix letters, digits, punctuation and accented characters over many lines
+    const std::u32string alphabet = U"AVAWATToYaLTfi the quick brown fox, 0123456789! \u00C0\u00E9\u00F1\u00FC\t";
+    std::u32string       string;
+    string.reserve(100'000);
+    for (std::size_t line = 0; string.size() < 100'000; ++line)
+    {
+        string += alphabet;
+        if (line % 3 == 2)
+            string += U'\n';
+    }
+    string.resize(100'000);
+
+    sf::Text text(font, string, 24);
+    (void)text.getLocalBounds();
+
+    BENCHMARK("Lay out 100k characters")
+    {
+        text.setLetterSpacing(text.getLetterSpacing() == 1.f ? 1.5f : 1.f);
+        return text.getLocalBounds();
+    };
+}
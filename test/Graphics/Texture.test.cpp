@@ -2,17 +2,24 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/Sleep.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
 #include <array>
+#include <future>
 #include <type_traits>
 
+#include <cstdint>
+#include <cstring>
+
 TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
 {
     SECTION("Type traits")
@@ -359,6 +366,129 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         }
     }
 
+    SECTION("Asynchronous upload")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::Texture::Upload>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::Texture::Upload>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::Texture::Upload>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::Texture::Upload>);
+
+        SECTION("Empty upload")
+        {
+            sf::Texture         texture;
+            sf::Texture::Upload upload = texture.beginUpload(sf::Vector2u(0, 0));
+            CHECK(upload.getPixels() == nullptr);
+            CHECK(!upload.isComplete());
+            CHECK(!texture.submitUpload(upload));
+        }
+
+        SECTION("Pixels, size and destination")
+        {
+            sf::Texture         texture(sf::Vector2u(2, 1));
+            sf::Texture::Upload upload = texture.beginUpload(sf::Vector2u(1, 1), sf::Vector2u(1, 0));
+            REQUIRE(upload.getPixels() != nullptr);
+            CHECK(upload.getSize() == sf::Vector2u(1, 1));
+            static constexpr std::array<std::uint8_t, 4> cyan = {0x00, 0xFF, 0xFF, 0xFF};
+            std::memcpy(upload.getPixels(), cyan.data(), cyan.size());
+            CHECK(!upload.isComplete());
+            CHECK(texture.submitUpload(upload));
+            CHECK(upload.getPixels() == nullptr);
+            CHECK(!texture.submitUpload(upload));
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(1, 0)) == sf::Color::Cyan);
+        }
+
+        SECTION("Filled from another thread")
+        {
+            sf::Texture         texture(sf::Vector2u(4, 4));
+            sf::Texture::Upload upload = texture.beginUpload(sf::Vector2u(4, 4));
+            REQUIRE(upload.getPixels() != nullptr);
+
+            std::async(std::launch::async,
+                       [pixels = upload.getPixels()]
+                       {
+                           static constexpr std::array<std::uint8_t, 4> magenta = {0xFF, 0x00, 0xFF, 0xFF};
+                           for (std::size_t i = 0; i < 4 * 4; ++i)
+                               std::memcpy(pixels + i * magenta.size(), magenta.data(), magenta.size());
+                       })
+                .get();
+
+            REQUIRE(texture.submitUpload(upload));
+
+            // The copy completes without the caller having to wait for it
+            bool complete = upload.isComplete();
+            for (int attempt = 0; (attempt < 1000) && !complete; ++attempt)
+            {
+                sf::sleep(sf::milliseconds(1));
+                complete = upload.isComplete();
+            }
+            CHECK(complete);
+            CHECK(upload.isComplete());
+
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel(sf::Vector2u(0, 0)) == sf::Color::Magenta);
+            CHECK(image.getPixel(sf::Vector2u(3, 3)) == sf::Color::Magenta);
+        }
+    }
+
+    SECTION("copyToImageAsync()")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::Texture::Readback>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::Texture::Readback>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::Texture::Readback>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::Texture::Readback>);
+
+        SECTION("Empty texture")
+        {
+            const sf::Texture     texture;
+            sf::Texture::Readback readback = texture.copyToImageAsync();
+            CHECK(!readback.isValid());
+            CHECK(!readback.isReady());
+            CHECK(readback.get().getSize() == sf::Vector2u());
+        }
+
+        SECTION("Pixels")
+        {
+            sf::Texture texture(sf::Vector2u(2, 1));
+            texture.update(sf::Image(sf::Vector2u(1, 1), sf::Color::Red), sf::Vector2u(0, 0));
+            texture.update(sf::Image(sf::Vector2u(1, 1), sf::Color::Green), sf::Vector2u(1, 0));
+            sf::Texture::Readback readback = texture.copyToImageAsync();
+            REQUIRE(readback.isValid());
+
+            // The readback captures the texture as it was when it was issued
+            texture.update(sf::Image(sf::Vector2u(1, 1), sf::Color::Blue), sf::Vector2u(0, 0));
+
+            const sf::Image image = readback.get();
+            CHECK(!readback.isValid());
+            CHECK(image.getSize() == sf::Vector2u(2, 1));
+            CHECK(image.getPixel(sf::Vector2u(0, 0)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(1, 0)) == sf::Color::Green);
+        }
+
+        SECTION("Render texture")
+        {
+            // Render textures are flipped and may be larger than requested,
+            // the image must still be upright and have the requested size
+            sf::RenderTexture renderTexture(sf::Vector2u(5, 4));
+            renderTexture.clear(sf::Color::Blue);
+            sf::RectangleShape top(sf::Vector2f(5, 2));
+            top.setFillColor(sf::Color::Red);
+            renderTexture.draw(top);
+            renderTexture.display();
+
+            sf::Texture::Readback readback = renderTexture.getTexture().copyToImageAsync();
+            REQUIRE(readback.isValid());
+
+            // The pixels are retrieved off the thread that issued the readback
+            const sf::Image image = std::async(std::launch::async, [&readback] { return readback.get(); }).get();
+            CHECK(!readback.isValid());
+            CHECK(image.getSize() == sf::Vector2u(5, 4));
+            CHECK(image.getPixel(sf::Vector2u(0, 0)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(4, 1)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(0, 2)) == sf::Color::Blue);
+            CHECK(image.getPixel(sf::Vector2u(4, 3)) == sf::Color::Blue);
+        }
+    }
+
     SECTION("Set/get smooth")
     {
         sf::Texture texture(sf::Vector2u(64, 64));
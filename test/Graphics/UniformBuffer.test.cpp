@@ -0,0 +1,167 @@
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <array>
+#include <type_traits>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::UniformBuffer", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_swappable_v<sf::UniformBuffer>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::UniformBuffer uniformBuffer;
+            CHECK(uniformBuffer.getSize() == 0);
+            CHECK(uniformBuffer.getNativeHandle() == 0);
+            CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Stream);
+        }
+
+        SECTION("Usage constructor")
+        {
+            const sf::UniformBuffer uniformBuffer(sf::UniformBuffer::Usage::Static);
+            CHECK(uniformBuffer.getSize() == 0);
+            CHECK(uniformBuffer.getNativeHandle() == 0);
+            CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Static);
+        }
+    }
+
+    SECTION("Set/get usage")
+    {
+        sf::UniformBuffer uniformBuffer;
+        uniformBuffer.setUsage(sf::UniformBuffer::Usage::Dynamic);
+        CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Dynamic);
+    }
+
+    // Creation fails cleanly if uniform buffers aren't available
+    if (!sf::UniformBuffer::isAvailable())
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(!uniformBuffer.create(64));
+        CHECK(uniformBuffer.getSize() == 0);
+        CHECK(uniformBuffer.getNativeHandle() == 0);
+        return;
+    }
+
+    SECTION("create()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.create(64));
+        CHECK(uniformBuffer.getSize() == 64);
+        CHECK(uniformBuffer.getNativeHandle() != 0);
+    }
+
+    SECTION("update()")
+    {
+        sf::UniformBuffer     uniformBuffer;
+        std::array<float, 32> data{};
+
+        SECTION("Uninitialized buffer")
+        {
+            CHECK(!uniformBuffer.update(data.data()));
+        }
+
+        CHECK(uniformBuffer.create(64));
+
+        SECTION("Null data")
+        {
+            CHECK(!uniformBuffer.update(nullptr, 16, 0));
+            CHECK(uniformBuffer.getSize() == 64);
+        }
+
+        SECTION("Whole buffer")
+        {
+            CHECK(uniformBuffer.update(data.data()));
+            CHECK(uniformBuffer.getSize() == 64);
+        }
+
+        SECTION("Resize")
+        {
+            CHECK(uniformBuffer.update(data.data(), sizeof(data), 0));
+            CHECK(uniformBuffer.getSize() == sizeof(data));
+        }
+
+        SECTION("Offset")
+        {
+            CHECK(uniformBuffer.update(data.data(), 16, 48));
+            CHECK(!uniformBuffer.update(data.data(), 17, 48));
+            CHECK(uniformBuffer.getSize() == 64);
+        }
+
+        SECTION("Another buffer")
+        {
+            sf::UniformBuffer otherBuffer;
+            CHECK(otherBuffer.create(64));
+            CHECK(uniformBuffer.update(otherBuffer));
+            CHECK(uniformBuffer.getSize() == 64);
+        }
+
+        SECTION("Larger buffer")
+        {
+            sf::UniformBuffer otherBuffer;
+            CHECK(otherBuffer.create(sizeof(data)));
+            CHECK(otherBuffer.update(data.data()));
+            CHECK(uniformBuffer.update(otherBuffer));
+            CHECK(uniformBuffer.getSize() == sizeof(data));
+        }
+
+        SECTION("Smaller buffer")
+        {
+            sf::UniformBuffer otherBuffer;
+            CHECK(otherBuffer.create(16));
+            CHECK(uniformBuffer.update(otherBuffer));
+            CHECK(uniformBuffer.getSize() == 16);
+        }
+    }
+
+    SECTION("Copy semantics")
+    {
+        sf::UniformBuffer uniformBuffer(sf::UniformBuffer::Usage::Dynamic);
+        CHECK(uniformBuffer.create(64));
+
+        SECTION("Construction")
+        {
+            const sf::UniformBuffer uniformBufferCopy(uniformBuffer); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(uniformBufferCopy.getSize() == 64);
+            CHECK(uniformBufferCopy.getUsage() == sf::UniformBuffer::Usage::Dynamic);
+            CHECK(uniformBufferCopy.getNativeHandle() != uniformBuffer.getNativeHandle());
+        }
+
+        SECTION("Assignment")
+        {
+            sf::UniformBuffer uniformBufferCopy;
+            uniformBufferCopy = uniformBuffer;
+            CHECK(uniformBufferCopy.getSize() == 64);
+            CHECK(uniformBufferCopy.getUsage() == sf::UniformBuffer::Usage::Dynamic);
+        }
+    }
+
+    SECTION("swap()")
+    {
+        sf::UniformBuffer uniformBuffer1(sf::UniformBuffer::Usage::Dynamic);
+        CHECK(uniformBuffer1.create(32));
+
+        sf::UniformBuffer uniformBuffer2(sf::UniformBuffer::Usage::Static);
+        CHECK(uniformBuffer2.create(64));
+
+        sf::swap(uniformBuffer1, uniformBuffer2);
+
+        CHECK(uniformBuffer1.getSize() == 64);
+        CHECK(uniformBuffer1.getUsage() == sf::UniformBuffer::Usage::Static);
+        CHECK(uniformBuffer2.getSize() == 32);
+        CHECK(uniformBuffer2.getUsage() == sf::UniformBuffer::Usage::Dynamic);
+    }
+}
@@ -95,6 +95,7 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         sf::VertexBuffer vertexBuffer;
         CHECK(vertexBuffer.create(100));
         CHECK(vertexBuffer.getVertexCount() == 100);
+        CHECK(vertexBuffer.getCapacity() == 100);
     }
 
     SECTION("update()")
@@ -144,6 +145,73 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         }
     }
 
+    SECTION("Streaming")
+    {
+        sf::VertexBuffer vertexBuffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Streaming);
+
+        SECTION("Uninitialized buffer")
+        {
+            CHECK(vertexBuffer.map(3) == nullptr);
+            CHECK(!vertexBuffer.unmap());
+        }
+
+        CHECK(vertexBuffer.create(30));
+        CHECK(vertexBuffer.getVertexCount() == 30);
+        CHECK(vertexBuffer.getCapacity() == 30);
+
+        SECTION("Vertex count and capacity")
+        {
+            // Only the last written region is drawn, the capacity stays the created size
+            CHECK(vertexBuffer.map(3) != nullptr);
+            CHECK(vertexBuffer.unmap());
+            CHECK(vertexBuffer.getVertexCount() == 3);
+            CHECK(vertexBuffer.getCapacity() == 30);
+        }
+
+        SECTION("Too many vertices")
+        {
+            CHECK(vertexBuffer.map(31) == nullptr);
+        }
+
+        SECTION("Map twice")
+        {
+            CHECK(vertexBuffer.map(3) != nullptr);
+            CHECK(vertexBuffer.map(3) == nullptr);
+            CHECK(vertexBuffer.unmap());
+        }
+
+        SECTION("Map and unmap")
+        {
+            // Go around the ring a few times
+            for (std::size_t i = 1; i <= 20; ++i)
+            {
+                sf::Vertex* vertices = vertexBuffer.map(i);
+                REQUIRE(vertices != nullptr);
+                for (std::size_t j = 0; j < i; ++j)
+                    vertices[j] = sf::Vertex{{1, 2}};
+                CHECK(vertexBuffer.unmap());
+                CHECK(vertexBuffer.getVertexCount() == i);
+            }
+
+            CHECK(!vertexBuffer.unmap());
+        }
+
+        SECTION("update()")
+        {
+            const std::array<sf::Vertex, 12> vertices{};
+            CHECK(!vertexBuffer.update(vertices.data(), 12, 1));
+            CHECK(vertexBuffer.update(vertices.data(), 12, 0));
+            CHECK(vertexBuffer.getVertexCount() == 12);
+        }
+
+        SECTION("Copy")
+        {
+            const sf::VertexBuffer vertexBufferCopy(vertexBuffer); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(vertexBufferCopy.getVertexCount() == 30);
+            CHECK(vertexBufferCopy.getUsage() == sf::VertexBuffer::Usage::Streaming);
+        }
+    }
+
     SECTION("swap()")
     {
         sf::VertexBuffer vertexBuffer1(sf::PrimitiveType::LineStrip, sf::VertexBuffer::Usage::Dynamic);